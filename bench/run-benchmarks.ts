@@ -0,0 +1,295 @@
+/**
+ * Performance benchmark suite for the disassembly pipeline.
+ *
+ * Runs each stage - InstructionDecoder.decode(), AnalysisEngine.analyze(),
+ * and the output formatters - over synthetic LoROM images of several sizes,
+ * reports ops/sec (full passes over the image per second) and peak RSS, and
+ * compares the numbers against the checked-in bench/baseline.json.
+ *
+ * Usage:
+ *   npm run bench                     compare against baseline, exit 1 on regression
+ *   npm run bench:update              rewrite baseline with this machine's numbers
+ *   BENCH_THRESHOLD=0.3 npm run bench loosen the regression threshold (default 0.25)
+ *
+ * Baseline numbers are machine-specific; regenerate them with bench:update
+ * when moving to new CI hardware, then gate vendored upgrades on the diff.
+ */
+
+import * as fs from 'fs';
+import * as path from 'path';
+import { InstructionDecoder } from '../src/decoder';
+import { AnalysisEngine } from '../src/analysis-engine';
+import { CA65Formatter, JSONFormatter } from '../src/output-formats-extended';
+import { DisassemblyLine } from '../src/types';
+import { SNESRom } from '../src/rom-parser';
+import { CartridgeType, MemorySpeed, CartridgeInfo } from '../src/cartridge-types';
+
+const BASELINE_PATH = path.join(__dirname, 'baseline.json');
+const DEFAULT_THRESHOLD = 0.25;
+
+/**
+ * Image sizes exercised per stage, in bytes. Decode and format are linear
+ * in image size; analyze() is currently superlinear in line count, so its
+ * ladder stays small enough for the suite to finish in about a minute
+ * while still exposing regressions in its scaling behavior.
+ */
+const DECODE_SIZES: Array<{ label: string; bytes: number }> = [
+  { label: '64KB', bytes: 0x10000 },
+  { label: '256KB', bytes: 0x40000 },
+  { label: '1MB', bytes: 0x100000 }
+];
+const ANALYZE_SIZES: Array<{ label: string; bytes: number }> = [
+  { label: '4KB', bytes: 0x1000 },
+  { label: '16KB', bytes: 0x4000 },
+  { label: '32KB', bytes: 0x8000 }
+];
+const FORMAT_SIZES: Array<{ label: string; bytes: number }> = [
+  { label: '64KB', bytes: 0x10000 },
+  { label: '256KB', bytes: 0x40000 }
+];
+
+/** Minimum wall time and iterations per benchmark for stable numbers */
+const MIN_RUN_MS = 500;
+const MIN_ITERATIONS = 3;
+
+interface BenchmarkResult {
+  opsPerSec: number;
+  peakRssBytes: number;
+}
+
+interface BaselineFile {
+  capturedAt: string;
+  benchmarks: Record<string, BenchmarkResult>;
+}
+
+/**
+ * Deterministic 16-byte instruction template repeated across the image:
+ * a PHB/PHK/PLB prologue, absolute loads/stores, a JSR, a short loop, and
+ * an RTS. Operands vary via an LCG so tables and cross-references differ
+ * per repetition, exercising the analysis phases realistically.
+ */
+function buildSyntheticImage(bytes: number): Buffer {
+  const data = Buffer.alloc(bytes);
+  let seed = 0x2C01;
+  const next = (): number => {
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+    return seed;
+  };
+
+  for (let offset = 0; offset + 16 <= bytes; offset += 16) {
+    const load = next();
+    const store = next();
+    const target = next();
+    data[offset] = 0x8B;                          // PHB
+    data[offset + 1] = 0x4B;                      // PHK
+    data[offset + 2] = 0xAB;                      // PLB
+    data[offset + 3] = 0xAD;                      // LDA abs
+    data[offset + 4] = load & 0xFF;
+    data[offset + 5] = 0x80 | (load >> 8) & 0x7F;
+    data[offset + 6] = 0x8D;                      // STA abs
+    data[offset + 7] = store & 0xFF;
+    data[offset + 8] = 0x80 | (store >> 8) & 0x7F;
+    data[offset + 9] = 0x20;                      // JSR abs
+    data[offset + 10] = target & 0xFF;
+    data[offset + 11] = 0x80 | (target >> 8) & 0x7F;
+    data[offset + 12] = 0xE8;                     // INX
+    data[offset + 13] = 0xD0;                     // BNE
+    data[offset + 14] = 0xF8;                     //   -8
+    data[offset + 15] = 0x60;                     // RTS
+  }
+
+  return data;
+}
+
+function buildCartridgeInfo(bytes: number): CartridgeInfo {
+  return {
+    type: CartridgeType.LoROM,
+    mapMode: 0x20,
+    romSize: bytes >> 10,
+    ramSize: 0,
+    hasBattery: false,
+    hasRTC: false,
+    speed: MemorySpeed.SlowROM,
+    regions: []
+  };
+}
+
+function buildSyntheticRom(data: Buffer): SNESRom {
+  const vectors = { cop: 0, brk: 0, abort: 0, nmi: 0x8000, reset: 0x8000, irq: 0 };
+  return {
+    header: {
+      title: 'BENCHMARK IMAGE',
+      mapMode: 0x20,
+      cartridgeType: 0,
+      romSize: 0,
+      ramSize: 0,
+      countryCode: 0,
+      licenseCode: 0,
+      versionNumber: 0,
+      checksum: 0,
+      complement: 0,
+      nativeVectors: vectors,
+      emulationVectors: vectors
+    },
+    data,
+    isHiRom: false,
+    hasHeader: false,
+    cartridgeInfo: buildCartridgeInfo(data.length),
+    memoryRegions: []
+  };
+}
+
+/** Map a ROM offset to its LoROM CPU address */
+function loromAddress(offset: number): number {
+  return ((offset >> 15) << 16) | 0x8000 | (offset & 0x7FFF);
+}
+
+/** Decode a full image into DisassemblyLines */
+function decodeImage(decoder: InstructionDecoder, data: Buffer): DisassemblyLine[] {
+  const lines: DisassemblyLine[] = [];
+  let offset = 0;
+  while (offset < data.length) {
+    const line = decoder.decode(data, offset, loromAddress(offset));
+    if (!line) {
+      offset++;
+      continue;
+    }
+    lines.push(line);
+    offset += line.instruction.bytes;
+  }
+  return lines;
+}
+
+/**
+ * Time one benchmark: run `op` until both MIN_RUN_MS and MIN_ITERATIONS
+ * are met, sampling RSS after each iteration.
+ */
+function measure(op: () => void): BenchmarkResult {
+  // Warm-up pass so JIT compilation does not skew the first sample
+  op();
+
+  let iterations = 0;
+  let peakRssBytes = 0;
+  const start = process.hrtime.bigint();
+  let elapsedMs = 0;
+
+  do {
+    op();
+    iterations++;
+    peakRssBytes = Math.max(peakRssBytes, process.memoryUsage().rss);
+    elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+  } while (elapsedMs < MIN_RUN_MS || iterations < MIN_ITERATIONS);
+
+  return {
+    opsPerSec: Math.round((iterations / (elapsedMs / 1000)) * 100) / 100,
+    peakRssBytes
+  };
+}
+
+function runSuite(): Record<string, BenchmarkResult> {
+  const results: Record<string, BenchmarkResult> = {};
+  const decoder = new InstructionDecoder();
+
+  for (const { label, bytes } of DECODE_SIZES) {
+    const data = buildSyntheticImage(bytes);
+    results[`decode/${label}`] = measure(() => {
+      decodeImage(new InstructionDecoder(), data);
+    });
+  }
+
+  for (const { label, bytes } of ANALYZE_SIZES) {
+    const data = buildSyntheticImage(bytes);
+    const rom = buildSyntheticRom(data);
+    const lines = decodeImage(decoder, data);
+    results[`analyze/${label}`] = measure(() => {
+      new AnalysisEngine().analyze(lines, rom.cartridgeInfo);
+    });
+  }
+
+  for (const { label, bytes } of FORMAT_SIZES) {
+    const data = buildSyntheticImage(bytes);
+    const rom = buildSyntheticRom(data);
+    const lines = decodeImage(decoder, data);
+    results[`format-ca65/${label}`] = measure(() => {
+      new CA65Formatter(rom).format(lines);
+    });
+    results[`format-json/${label}`] = measure(() => {
+      new JSONFormatter(rom).format(lines);
+    });
+  }
+
+  return results;
+}
+
+function loadBaseline(): BaselineFile | null {
+  if (!fs.existsSync(BASELINE_PATH)) return null;
+  return JSON.parse(fs.readFileSync(BASELINE_PATH, 'utf8')) as BaselineFile;
+}
+
+function formatRss(bytes: number): string {
+  return `${(bytes / (1024 * 1024)).toFixed(1)}MB`;
+}
+
+function main(): void {
+  const updateBaseline = process.argv.includes('--update-baseline');
+  const threshold = Number(process.env.BENCH_THRESHOLD) || DEFAULT_THRESHOLD;
+
+  console.log('Running disassembly pipeline benchmarks...\n');
+  const results = runSuite();
+
+  const baseline = loadBaseline();
+  const regressions: string[] = [];
+  const rssWarnings: string[] = [];
+
+  const nameWidth = Math.max(...Object.keys(results).map(name => name.length));
+  for (const [name, result] of Object.entries(results)) {
+    const base = baseline?.benchmarks[name];
+    let delta = '';
+    if (base) {
+      const ratio = result.opsPerSec / base.opsPerSec;
+      delta = ` (${ratio >= 1 ? '+' : ''}${((ratio - 1) * 100).toFixed(1)}% vs baseline)`;
+      if (result.opsPerSec < base.opsPerSec * (1 - threshold)) {
+        regressions.push(`${name}: ${result.opsPerSec} ops/sec vs baseline ${base.opsPerSec} (threshold ${threshold * 100}%)`);
+      }
+      // Peak RSS is process-global and GC-timing dependent, so it is too
+      // noisy to gate on: report growth beyond the threshold as a warning
+      if (result.peakRssBytes > base.peakRssBytes * (1 + threshold)) {
+        rssWarnings.push(`${name}: peak RSS ${formatRss(result.peakRssBytes)} vs baseline ${formatRss(base.peakRssBytes)}`);
+      }
+    } else if (baseline) {
+      delta = ' (no baseline entry)';
+    }
+    console.log(`${name.padEnd(nameWidth)}  ${String(result.opsPerSec).padStart(10)} ops/sec  peak RSS ${formatRss(result.peakRssBytes)}${delta}`);
+  }
+
+  if (updateBaseline) {
+    const file: BaselineFile = { capturedAt: new Date().toISOString(), benchmarks: results };
+    fs.writeFileSync(BASELINE_PATH, JSON.stringify(file, null, 2) + '\n');
+    console.log(`\nBaseline written to ${BASELINE_PATH}`);
+    return;
+  }
+
+  if (!baseline) {
+    console.log('\nNo baseline found - run `npm run bench:update` to capture one.');
+    return;
+  }
+
+  if (rssWarnings.length > 0) {
+    console.warn('\nPeak RSS grew beyond threshold (informational only):');
+    for (const warning of rssWarnings) {
+      console.warn(`  - ${warning}`);
+    }
+  }
+
+  if (regressions.length > 0) {
+    console.error('\nPerformance regressions detected:');
+    for (const regression of regressions) {
+      console.error(`  - ${regression}`);
+    }
+    process.exit(1);
+  }
+
+  console.log('\nAll benchmarks within threshold.');
+}
+
+main();
@@ -55,6 +55,37 @@ export interface CompressionInfo {
   decompressHint?: string;
 }
 
+export interface DataRegionClassification {
+  graphics?: GraphicsClassification;
+  audio?: AudioClassification;
+  text?: TextClassification;
+  compression?: CompressionInfo;
+  mostLikely: 'graphics' | 'audio' | 'text' | 'code' | 'unknown';
+  confidence: number;
+}
+
+/** A region of the ROM to classify, as (offset, length) into the shared buffer */
+export interface RegionDescriptor {
+  offset: number;
+  length: number;
+}
+
+/**
+ * Statistics shared by several classifiers, computed in one pass over a
+ * region instead of once per classifier
+ */
+export interface RegionFeatures {
+  histogram: Uint32Array;
+  entropy: number;
+  repetition: number;
+  variation: number;
+}
+
+export interface BatchClassificationOptions {
+  /** Maximum classifications in flight at once (default 4) */
+  concurrency?: number;
+}
+
 // Import real AI model implementations
 import {
   ViTGraphicsClassifier,
@@ -71,6 +102,15 @@ export class AIPatternRecognizer {
   private sequenceClassifier?: DistilBERTSequenceClassifier;
   private compressionDetector?: AICompressionDetector;
 
+  /**
+   * Classification results memoized by region content hash. ROMs repeat
+   * data (tile banks, blank fill, mirrored regions), so batch runs over
+   * hundreds of regions hit the same bytes again and again. Bounded by
+   * evicting the oldest entry, insertion order, once full.
+   */
+  private classificationCache = new Map<string, DataRegionClassification>();
+  private static readonly MAX_CACHED_CLASSIFICATIONS = 1024;
+
   constructor(private modelPath?: string) {
     // Initialize AI models - placeholders for future implementation
     this.initializeModels();
@@ -79,10 +119,10 @@ export class AIPatternRecognizer {
   /**
    * Classify graphics data using Vision Transformer approach
    */
-  async classifyGraphicsData(data: Uint8Array, format: '2bpp' | '4bpp' | '8bpp'): Promise<GraphicsClassification> {
+  async classifyGraphicsData(data: Uint8Array, format: '2bpp' | '4bpp' | '8bpp', features?: RegionFeatures): Promise<GraphicsClassification> {
     if (!this.graphicsClassifier) {
       // Fallback to heuristic classification
-      return this.heuristicGraphicsClassification(data, format);
+      return this.heuristicGraphicsClassification(data, format, features);
     }
 
     // Convert SNES tile data to image patches for model processing
@@ -123,10 +163,10 @@ export class AIPatternRecognizer {
   /**
    * Detect compression patterns in binary data
    */
-  async detectCompression(data: Uint8Array): Promise<CompressionInfo> {
+  async detectCompression(data: Uint8Array, features?: RegionFeatures): Promise<CompressionInfo> {
     if (!this.compressionDetector) {
       // Fallback to statistical analysis
-      return this.statisticalCompressionDetection(data);
+      return this.statisticalCompressionDetection(data, features);
     }
 
     return await this.compressionDetector.analyze(data);
@@ -135,24 +175,28 @@ export class AIPatternRecognizer {
   /**
    * Comprehensive data classification combining all AI approaches
    */
-  async classifyDataRegion(data: Uint8Array, offset: number, length: number): Promise<{
-    graphics?: GraphicsClassification;
-    audio?: AudioClassification;
-    text?: TextClassification;
-    compression?: CompressionInfo;
-    mostLikely: 'graphics' | 'audio' | 'text' | 'code' | 'unknown';
-    confidence: number;
-  }> {
+  async classifyDataRegion(data: Uint8Array, offset: number, length: number): Promise<DataRegionClassification> {
     const region = data.slice(offset, offset + length);
 
+    // Check the content-hash memo before doing any work
+    const cacheKey = this.regionContentHash(region);
+    const cached = this.classificationCache.get(cacheKey);
+    if (cached) {
+      return { ...cached };
+    }
+
+    // Shared statistics in one pass; the heuristic classifiers would
+    // otherwise each recompute entropy and histograms over the same slice
+    const features = this.computeRegionFeatures(region);
+
     // Run all classifiers in parallel
     const [graphics2bpp, graphics4bpp, graphics8bpp, audio, text, compression] = await Promise.all([
-      this.classifyGraphicsData(region, '2bpp'),
-      this.classifyGraphicsData(region, '4bpp'),
-      this.classifyGraphicsData(region, '8bpp'),
+      this.classifyGraphicsData(region, '2bpp', features),
+      this.classifyGraphicsData(region, '4bpp', features),
+      this.classifyGraphicsData(region, '8bpp', features),
       this.classifyAudioData(region),
       this.classifyTextData(region),
-      this.detectCompression(region)
+      this.detectCompression(region, features)
     ]);
 
     // Find best graphics format
@@ -170,7 +214,7 @@ export class AIPatternRecognizer {
       current.confidence > best.confidence ? current : best
     );
 
-    return {
+    const result: DataRegionClassification = {
       graphics: graphics.confidence > 0.3 ? graphics : undefined,
       audio: audio.confidence > 0.3 ? audio : undefined,
       text: text.confidence > 0.3 ? text : undefined,
@@ -178,6 +222,114 @@ export class AIPatternRecognizer {
       mostLikely: mostLikely.confidence > 0.2 ? mostLikely.type : 'unknown',
       confidence: mostLikely.confidence
     };
+
+    this.memoizeClassification(cacheKey, result);
+    return { ...result };
+  }
+
+  /**
+   * Classify many regions of one ROM with bounded concurrency.
+   *
+   * Per-region awaits in a serial loop leave the process idle between
+   * classifications; hundreds of regions per ROM make that the long pole
+   * in enhanced disassembly runs. This runs up to `concurrency` region
+   * classifications at a time and returns results in input order. Regions
+   * with identical content (blank fill, mirrored banks) are served from
+   * the content-hash memo after the first is classified.
+   */
+  async classifyDataRegions(
+    data: Uint8Array,
+    regions: RegionDescriptor[],
+    options: BatchClassificationOptions = {}
+  ): Promise<DataRegionClassification[]> {
+    const concurrency = Math.max(1, options.concurrency ?? 4);
+    const results = new Array<DataRegionClassification>(regions.length);
+
+    let nextIndex = 0;
+    const worker = async (): Promise<void> => {
+      while (nextIndex < regions.length) {
+        const index = nextIndex++;
+        const { offset, length } = regions[index];
+        results[index] = await this.classifyDataRegion(data, offset, length);
+      }
+    };
+
+    const workers: Promise<void>[] = [];
+    for (let i = 0; i < Math.min(concurrency, regions.length); i++) {
+      workers.push(worker());
+    }
+    await Promise.all(workers);
+
+    return results;
+  }
+
+  /** Drop all memoized classification results */
+  clearClassificationCache(): void {
+    this.classificationCache.clear();
+  }
+
+  /**
+   * FNV-1a over the region content in two interleaved lanes, plus the
+   * length, so distinct regions rarely collide while hashing stays a
+   * single linear pass
+   */
+  private regionContentHash(region: Uint8Array): string {
+    let hashA = 0x811c9dc5;
+    let hashB = 0x811c9dc5 ^ 0x5bd1e995;
+    for (let i = 0; i < region.length; i++) {
+      hashA = Math.imul(hashA ^ region[i], 0x01000193);
+      hashB = Math.imul(hashB ^ region[region.length - 1 - i], 0x01000193);
+    }
+    return `${region.length}:${hashA >>> 0}:${hashB >>> 0}`;
+  }
+
+  private memoizeClassification(key: string, result: DataRegionClassification): void {
+    if (this.classificationCache.size >= AIPatternRecognizer.MAX_CACHED_CLASSIFICATIONS) {
+      const oldest = this.classificationCache.keys().next().value;
+      if (oldest !== undefined) {
+        this.classificationCache.delete(oldest);
+      }
+    }
+    this.classificationCache.set(key, { ...result });
+  }
+
+  /**
+   * Compute the statistics shared by the heuristic classifiers in a
+   * single pass over the region
+   */
+  private computeRegionFeatures(region: Uint8Array): RegionFeatures {
+    const histogram = new Uint32Array(256);
+    let repetitions = 0;
+    let sum = 0;
+    let sumSquares = 0;
+
+    for (let i = 0; i < region.length; i++) {
+      const byte = region[i];
+      histogram[byte]++;
+      sum += byte;
+      sumSquares += byte * byte;
+      if (i > 0 && byte === region[i - 1]) {
+        repetitions++;
+      }
+    }
+
+    let entropy = 0;
+    for (let i = 0; i < 256; i++) {
+      if (histogram[i] > 0) {
+        const prob = histogram[i] / region.length;
+        entropy -= prob * Math.log2(prob);
+      }
+    }
+
+    const mean = region.length > 0 ? sum / region.length : 0;
+    const variance = region.length > 0 ? (sumSquares / region.length) - (mean * mean) : 0;
+
+    return {
+      histogram,
+      entropy,
+      repetition: region.length > 1 ? repetitions / (region.length - 1) : 0,
+      variation: region.length >= 2 ? Math.sqrt(variance) / 255 : 0
+    };
   }
 
   private async initializeModels(): Promise<void> {
@@ -232,11 +384,11 @@ export class AIPatternRecognizer {
     return { data: imageData, width: imageWidth, height: imageHeight };
   }
 
-  private heuristicGraphicsClassification(data: Uint8Array, format: '2bpp' | '4bpp' | '8bpp'): GraphicsClassification {
+  private heuristicGraphicsClassification(data: Uint8Array, format: '2bpp' | '4bpp' | '8bpp', features?: RegionFeatures): GraphicsClassification {
     // Enhanced heuristic classification
-    const entropy = this.calculateEntropy(data);
-    const repetition = this.calculateRepetitionScore(data);
-    const patterns = this.detectCommonPatterns(data);
+    const entropy = features?.entropy ?? this.calculateEntropy(data);
+    const repetition = features?.repetition ?? this.calculateRepetitionScore(data);
+    const patterns = this.detectCommonPatterns(data, features);
 
     let type: GraphicsClassification['type'] = 'tile';
     let confidence = 0.5;
@@ -406,9 +558,9 @@ export class AIPatternRecognizer {
     };
   }
 
-  private statisticalCompressionDetection(data: Uint8Array): CompressionInfo {
-    const entropy = this.calculateEntropy(data);
-    const repetition = this.calculateRepetitionScore(data);
+  private statisticalCompressionDetection(data: Uint8Array, features?: RegionFeatures): CompressionInfo {
+    const entropy = features?.entropy ?? this.calculateEntropy(data);
+    const repetition = features?.repetition ?? this.calculateRepetitionScore(data);
 
     // High compression typically has higher entropy
     if (entropy > 7.5) {
@@ -470,7 +622,7 @@ export class AIPatternRecognizer {
     return repetitions / total;
   }
 
-  private detectCommonPatterns(data: Uint8Array): {
+  private detectCommonPatterns(data: Uint8Array, features?: RegionFeatures): {
     sprites: number;
     characters: number;
     textures: number;
@@ -478,7 +630,7 @@ export class AIPatternRecognizer {
     // Simplified pattern detection - would be enhanced with AI
     const sprites = this.detectSpritePatterns(data);
     const characters = this.detectCharacterPatterns(data);
-    const textures = this.detectTexturePatterns(data);
+    const textures = this.detectTexturePatterns(data, features);
 
     return { sprites, characters, textures };
   }
@@ -524,10 +676,10 @@ export class AIPatternRecognizer {
     return totalBlocks > 0 ? characterLike / totalBlocks : 0;
   }
 
-  private detectTexturePatterns(data: Uint8Array): number {
+  private detectTexturePatterns(data: Uint8Array, features?: RegionFeatures): number {
     // Look for texture-like repeating patterns
-    const entropy = this.calculateEntropy(data);
-    const variation = this.calculateVariation(data);
+    const entropy = features?.entropy ?? this.calculateEntropy(data);
+    const variation = features?.variation ?? this.calculateVariation(data);
 
     // Textures typically have moderate entropy and variation
     if (entropy > 4.0 && entropy < 6.0 && variation > 0.3) {
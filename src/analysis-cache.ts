@@ -11,7 +11,12 @@ import { ValidationResult } from './validation-engine';
 import { ROMAnalysis } from './enhanced-disassembly-engine';
 import { ExtractedAudioState } from './spc-state-extractor';
 import { createLogger, Logger } from './utils/logger';
+import { instrumentation } from './utils/instrumentation';
+import { encodeCacheEntry, decodeCacheEntry } from './binary-cache-format';
+import { BankHandler } from './bank-handler';
 import * as crypto from 'crypto';
+import * as fs from 'fs';
+import * as path from 'path';
 
 export interface CacheEntry {
   hash: string;
@@ -30,6 +35,7 @@ export interface AnalysisCacheConfig {
   enableMemoryCache: boolean;
   enablePersistentCache: boolean;
   cacheValidation: boolean;
+  cacheDirectory: string; // On-disk location for persistent cache files
 }
 
 interface CacheStats {
@@ -39,6 +45,12 @@ interface CacheStats {
   cacheSize: number;
 }
 
+// Instrumentation ids interned once; get()/getSegment() run on hot paths
+const CACHE_HIT_COUNTER = instrumentation.counter('cache.hits');
+const CACHE_MISS_COUNTER = instrumentation.counter('cache.misses');
+const SEGMENT_HIT_COUNTER = instrumentation.counter('cache.segmentHits');
+const SEGMENT_MISS_COUNTER = instrumentation.counter('cache.segmentMisses');
+
 /**
  * Centralized cache for ROM analysis results to eliminate redundant calculations
  */
@@ -72,6 +84,7 @@ export class ROMAnalysisCache {
       enableMemoryCache: true,
       enablePersistentCache: false,
       cacheValidation: true,
+      cacheDirectory: path.join(process.cwd(), '.snes-disasm-cache'),
       ...config
     };
     this.logger = createLogger('ROMAnalysisCache');
@@ -191,11 +204,24 @@ export class ROMAnalysisCache {
 
     if (entry && this.isValidCacheEntry(entry)) {
       this.stats.hits++;
+      instrumentation.increment(CACHE_HIT_COUNTER);
       this.logger.debug(`Cache HIT for ${analysisType}`, { key: key.substring(0, 16) + '...' });
       return entry.data as T;
     }
 
+    // Fall back to the persistent cache for warm starts across processes
+    const persistentEntry = this.loadPersistentEntry(key);
+    if (persistentEntry && this.isValidCacheEntry(persistentEntry)) {
+      this.memoryCache.set(key, persistentEntry);
+      this.stats.cacheSize = this.memoryCache.size;
+      this.stats.hits++;
+      instrumentation.increment(CACHE_HIT_COUNTER);
+      this.logger.debug(`Persistent cache HIT for ${analysisType}`, { key: key.substring(0, 16) + '...' });
+      return persistentEntry.data as T;
+    }
+
     this.stats.misses++;
+    instrumentation.increment(CACHE_MISS_COUNTER);
     this.logger.debug(`Cache MISS for ${analysisType}`, { key: key.substring(0, 16) + '...' });
     return null;
   }
@@ -236,13 +262,204 @@ export class ROMAnalysisCache {
 
     this.memoryCache.set(key, entry);
     this.stats.cacheSize = this.memoryCache.size;
-    
-    this.logger.debug(`Cached ${analysisType}`, { 
-      key: key.substring(0, 16) + '...', 
-      size: this.memoryCache.size 
+
+    this.storePersistentEntry(key, entry);
+
+    this.logger.debug(`Cached ${analysisType}`, {
+      key: key.substring(0, 16) + '...',
+      size: this.memoryCache.size
     });
   }
 
+  // =====================================================================
+  // Content-addressed segment layer
+  //
+  // ROM revisions and regional variants typically differ in a handful of
+  // banks; whole-ROM keys force a full re-analysis for a one-byte header
+  // change. The methods below key results on (segment index, segment
+  // content hash) with segments bank-aligned via BankHandler, so any ROM
+  // whose bank N has identical bytes shares the cached result. The index
+  // stays in the key because cached results embed absolute addresses.
+  // =====================================================================
+
+  /**
+   * Per-ROM memo of bank-aligned segment hashes, keyed on the ROM buffer
+   */
+  private segmentHashCache = new WeakMap<Buffer, { segmentSize: number; hashes: string[] }>();
+
+  /**
+   * Hash each bank-aligned segment of the ROM. Unlike calculateROMHash
+   * this covers every byte - content addressing is only sound if a hash
+   * match implies identical segment bytes.
+   */
+  private getSegmentHashes(rom: SNESRom): { segmentSize: number; hashes: string[] } {
+    const cached = this.segmentHashCache.get(rom.data);
+    if (cached) return cached;
+
+    const segmentSize = new BankHandler(rom.cartridgeInfo).getBankSize();
+    const hashes: string[] = [];
+    for (let offset = 0; offset < rom.data.length; offset += segmentSize) {
+      const segment = rom.data.slice(offset, Math.min(offset + segmentSize, rom.data.length));
+      hashes.push(crypto.createHash('md5').update(segment).digest('hex').substring(0, 16));
+    }
+
+    const result = { segmentSize, hashes };
+    this.segmentHashCache.set(rom.data, result);
+    return result;
+  }
+
+  /**
+   * Generate a content-addressed cache key for one ROM segment
+   */
+  private generateSegmentCacheKey(rom: SNESRom, analysisType: string, segmentIndex: number, params?: any): string | null {
+    const { hashes } = this.getSegmentHashes(rom);
+    if (segmentIndex < 0 || segmentIndex >= hashes.length) return null;
+    const paramsHash = params ? crypto.createHash('md5').update(JSON.stringify(params)).digest('hex').substring(0, 8) : '';
+    return `${analysisType}_seg${segmentIndex}_${hashes[segmentIndex]}_${paramsHash}`;
+  }
+
+  /**
+   * Number of bank-aligned segments in the ROM
+   */
+  getSegmentCount(rom: SNESRom): number {
+    return this.getSegmentHashes(rom).hashes.length;
+  }
+
+  /**
+   * Byte size of the ROM's bank-aligned segments
+   */
+  getSegmentSize(rom: SNESRom): number {
+    return this.getSegmentHashes(rom).segmentSize;
+  }
+
+  /**
+   * Get a cached per-segment result, matching any ROM whose segment
+   * content is identical at the same bank index
+   */
+  getSegment<T>(rom: SNESRom, analysisType: string, segmentIndex: number, params?: any): T | null {
+    if (!this.config.enableMemoryCache) return null;
+
+    const key = this.generateSegmentCacheKey(rom, analysisType, segmentIndex, params);
+    if (!key) return null;
+
+    const entry = this.memoryCache.get(key);
+    if (entry && this.isValidCacheEntry(entry)) {
+      this.stats.hits++;
+      instrumentation.increment(SEGMENT_HIT_COUNTER);
+      this.logger.debug(`Segment cache HIT for ${analysisType}`, { segment: segmentIndex, key: key.substring(0, 24) + '...' });
+      return entry.data as T;
+    }
+
+    const persistentEntry = this.loadPersistentEntry(key);
+    if (persistentEntry && this.isValidCacheEntry(persistentEntry)) {
+      this.memoryCache.set(key, persistentEntry);
+      this.stats.cacheSize = this.memoryCache.size;
+      this.stats.hits++;
+      instrumentation.increment(SEGMENT_HIT_COUNTER);
+      this.logger.debug(`Persistent segment cache HIT for ${analysisType}`, { segment: segmentIndex, key: key.substring(0, 24) + '...' });
+      return persistentEntry.data as T;
+    }
+
+    this.stats.misses++;
+    instrumentation.increment(SEGMENT_MISS_COUNTER);
+    return null;
+  }
+
+  /**
+   * Store a per-segment result under its content-addressed key
+   */
+  setSegment<T>(rom: SNESRom, analysisType: string, segmentIndex: number, data: T, params?: any): void {
+    if (!this.config.enableMemoryCache) return;
+
+    const key = this.generateSegmentCacheKey(rom, analysisType, segmentIndex, params);
+    if (!key) return;
+
+    if (this.memoryCache.size >= this.config.maxCacheSize) {
+      this.evictOldestEntry();
+    }
+
+    const entry: CacheEntry = {
+      hash: key,
+      timestamp: Date.now(),
+      data,
+      metadata: {
+        romSize: rom.data.length,
+        cartridgeType: rom.cartridgeInfo.type,
+        version: '1.0'
+      }
+    };
+
+    this.memoryCache.set(key, entry);
+    this.stats.cacheSize = this.memoryCache.size;
+
+    this.storePersistentEntry(key, entry);
+  }
+
+  /**
+   * Resolve the on-disk file for a cache key
+   */
+  private persistentFilePath(key: string): string {
+    return path.join(this.config.cacheDirectory, `${key}.sndc`);
+  }
+
+  /**
+   * Load a cache entry from the binary persistent store, if enabled.
+   * Unreadable or stale-format files are treated as misses.
+   */
+  private loadPersistentEntry(key: string): CacheEntry | null {
+    if (!this.config.enablePersistentCache) return null;
+
+    const filePath = this.persistentFilePath(key);
+    try {
+      if (!fs.existsSync(filePath)) return null;
+      const entry = decodeCacheEntry(fs.readFileSync(filePath));
+      if (!entry) {
+        this.logger.debug('Discarding persistent cache file with unknown format version', { file: filePath });
+        fs.unlinkSync(filePath);
+      }
+      return entry;
+    } catch (error) {
+      this.logger.warn('Failed to read persistent cache entry', { file: filePath, error: String(error) });
+      return null;
+    }
+  }
+
+  /**
+   * Write a cache entry to the binary persistent store, if enabled
+   */
+  private storePersistentEntry(key: string, entry: CacheEntry): void {
+    if (!this.config.enablePersistentCache) return;
+
+    const filePath = this.persistentFilePath(key);
+    try {
+      fs.mkdirSync(this.config.cacheDirectory, { recursive: true });
+      fs.writeFileSync(filePath, encodeCacheEntry(entry));
+    } catch (error) {
+      this.logger.warn('Failed to write persistent cache entry', { file: filePath, error: String(error) });
+    }
+  }
+
+  /**
+   * Remove persistent cache files whose keys match a predicate
+   */
+  private prunePersistentEntries(matches: (key: string) => boolean): number {
+    if (!this.config.enablePersistentCache) return 0;
+
+    let removed = 0;
+    try {
+      if (!fs.existsSync(this.config.cacheDirectory)) return 0;
+      for (const file of fs.readdirSync(this.config.cacheDirectory)) {
+        if (file.endsWith('.sndc') && matches(file.slice(0, -'.sndc'.length))) {
+          fs.unlinkSync(path.join(this.config.cacheDirectory, file));
+          removed++;
+        }
+      }
+    } catch (error) {
+      this.logger.warn('Failed to prune persistent cache entries', { error: String(error) });
+    }
+    return removed;
+  }
+
   /**
    * Evict oldest cache entry (LRU)
    */
@@ -279,8 +496,10 @@ export class ROMAnalysisCache {
 
     keysToDelete.forEach(key => this.memoryCache.delete(key));
     this.stats.cacheSize = this.memoryCache.size;
-    
-    this.logger.info(`Invalidated ${keysToDelete.length} cache entries for ROM`);
+
+    const removed = this.prunePersistentEntries(key => key.includes(romHash));
+
+    this.logger.info(`Invalidated ${keysToDelete.length} cache entries for ROM (${removed} persistent)`);
   }
 
   /**
@@ -290,7 +509,8 @@ export class ROMAnalysisCache {
     const size = this.memoryCache.size;
     this.memoryCache.clear();
     this.stats.cacheSize = 0;
-    this.logger.info(`Cleared ${size} cache entries`);
+    const removed = this.prunePersistentEntries(() => true);
+    this.logger.info(`Cleared ${size} cache entries (${removed} persistent)`);
   }
 
   /**
@@ -416,6 +636,14 @@ export class ROMAnalysisCache {
   setDisassembly(rom: SNESRom, lines: DisassemblyLine[], params: { start: number, end: number }): void {
     this.set(rom, ROMAnalysisCache.CACHE_KEYS.DISASSEMBLY, lines, params);
   }
+
+  getBankDisassembly(rom: SNESRom, bank: number): DisassemblyLine[] | null {
+    return this.getSegment<DisassemblyLine[]>(rom, ROMAnalysisCache.CACHE_KEYS.DISASSEMBLY, bank);
+  }
+
+  setBankDisassembly(rom: SNESRom, bank: number, lines: DisassemblyLine[]): void {
+    this.setSegment(rom, ROMAnalysisCache.CACHE_KEYS.DISASSEMBLY, bank, lines);
+  }
 }
 
 /**
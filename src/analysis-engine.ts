@@ -11,6 +11,24 @@ import {
   getRegisterInfo,
   type InstructionReference
 } from './snes-reference-tables';
+import { instrumentation } from './utils/instrumentation';
+
+// Per-pass timer ids, interned once so analyze() only pays for sampled reads
+const PASS_TIMERS = {
+  basicBlocks: instrumentation.timer('analysis.basicBlocks'),
+  controlFlow: instrumentation.timer('analysis.controlFlow'),
+  functions: instrumentation.timer('analysis.functions'),
+  dataStructures: instrumentation.timer('analysis.dataStructures'),
+  crossReferences: instrumentation.timer('analysis.crossReferences'),
+  symbols: instrumentation.timer('analysis.symbols'),
+  hardwareRegisters: instrumentation.timer('analysis.hardwareRegisters'),
+  recursiveDescent: instrumentation.timer('analysis.recursiveDescent'),
+  stringAudio: instrumentation.timer('analysis.stringAudio'),
+  dataFlow: instrumentation.timer('analysis.dataFlow'),
+  macros: instrumentation.timer('analysis.macros'),
+  gamePatterns: instrumentation.timer('analysis.gamePatterns'),
+  qualityMetrics: instrumentation.timer('analysis.qualityMetrics')
+};
 
 interface BasicBlock {
   id: string;
@@ -49,6 +67,11 @@ export interface CrossReference {
   instruction?: string;
 }
 
+export interface AddressRange {
+  start: number;
+  end: number;
+}
+
 export interface SymbolInfo {
   address: number;
   name: string;
@@ -99,6 +122,515 @@ interface HardwareRegisterUsage {
   description: string;
 }
 
+/**
+ * Shared sorted address index built once per analyze() call.
+ *
+ * The analysis passes repeatedly need to answer "is there a line at this
+ * address", "is this address a branch/JSR target" and "which operands fall
+ * near this table" - previously each answer was a linear scan over lines,
+ * making cross-reference heavy passes quadratic. This structure answers all
+ * of them in O(log n) or O(1): a sorted line-address array for ordinal
+ * lookup, bitsets over the 24-bit address space for branch and JSR targets,
+ * and a sorted operand multiset for table-size estimation.
+ */
+class AddressIndex {
+  private lineAddresses: number[];
+  private sortedOperands: number[];
+  private branchTargetBits: Uint8Array;
+  private jsrTargetBits: Uint8Array;
+
+  // 24-bit SNES address space => 16M bits => 2MB per bitset
+  private static readonly BITSET_BYTES = 0x1000000 >> 3;
+
+  constructor(lines: DisassemblyLine[]) {
+    this.lineAddresses = new Array(lines.length);
+    this.sortedOperands = [];
+    this.branchTargetBits = new Uint8Array(AddressIndex.BITSET_BYTES);
+    this.jsrTargetBits = new Uint8Array(AddressIndex.BITSET_BYTES);
+
+    for (let i = 0; i < lines.length; i++) {
+      const line = lines[i];
+      this.lineAddresses[i] = line.address;
+
+      if (line.operand !== undefined) {
+        this.sortedOperands.push(line.operand);
+
+        const mnemonic = line.instruction.mnemonic;
+        if (mnemonic.startsWith('B') || mnemonic.startsWith('J')) {
+          this.setBit(this.branchTargetBits, line.operand);
+        }
+        if (mnemonic === 'JSR') {
+          this.setBit(this.jsrTargetBits, line.operand);
+        }
+      }
+    }
+
+    this.sortedOperands.sort((a, b) => a - b);
+  }
+
+  private setBit(bits: Uint8Array, address: number): void {
+    if (address >= 0 && address < 0x1000000) {
+      bits[address >> 3] |= 1 << (address & 7);
+    }
+  }
+
+  private getBit(bits: Uint8Array, address: number): boolean {
+    return address >= 0 && address < 0x1000000 && (bits[address >> 3] & (1 << (address & 7))) !== 0;
+  }
+
+  /** Ordinal of the line at the given address, or -1 if no line starts there */
+  lineOrdinal(address: number): number {
+    let lo = 0;
+    let hi = this.lineAddresses.length - 1;
+    while (lo <= hi) {
+      const mid = (lo + hi) >> 1;
+      const midAddr = this.lineAddresses[mid];
+      if (midAddr === address) return mid;
+      if (midAddr < address) lo = mid + 1;
+      else hi = mid - 1;
+    }
+    return -1;
+  }
+
+  hasLine(address: number): boolean {
+    return this.lineOrdinal(address) !== -1;
+  }
+
+  isBranchTarget(address: number): boolean {
+    return this.getBit(this.branchTargetBits, address);
+  }
+
+  isJsrTarget(address: number): boolean {
+    return this.getBit(this.jsrTargetBits, address);
+  }
+
+  /**
+   * Largest operand offset from tableAddr within the given window, derived
+   * from the sorted operand multiset via binary search
+   */
+  maxOperandOffset(tableAddr: number, window: number): number {
+    let lo = 0;
+    let hi = this.sortedOperands.length;
+    while (lo < hi) {
+      const mid = (lo + hi) >> 1;
+      if (this.sortedOperands[mid] < tableAddr) lo = mid + 1;
+      else hi = mid;
+    }
+
+    let maxOffset = 0;
+    for (let i = lo; i < this.sortedOperands.length && this.sortedOperands[i] - tableAddr < window; i++) {
+      maxOffset = Math.max(maxOffset, this.sortedOperands[i] - tableAddr);
+    }
+    return maxOffset;
+  }
+}
+
+/**
+ * Compact integer-indexed view of the control flow graph.
+ *
+ * The object CFG stores edges as Sets of block-id strings, which costs
+ * hashing on every membership test and scatters blocks across the heap;
+ * consumers that need traversal orders re-walk it with ad-hoc searches.
+ * This representation numbers the blocks densely in start-address order
+ * and keeps successors and predecessors in flat Int32Array adjacency
+ * (CSR layout: an offsets array of length n+1 indexing into one packed
+ * edge array). Reverse postorder and immediate dominators are computed
+ * once on first request and cached, so every consumer shares them.
+ *
+ * Built once per analyze() after the object CFG; query it via
+ * AnalysisEngine.getCompactControlFlowGraph().
+ */
+export class CompactControlFlowGraph {
+  private readonly blockIds: string[];
+  private readonly idToIndex: Map<string, number>;
+  private readonly startAddresses: Int32Array;
+  private readonly endAddresses: Int32Array;
+
+  private readonly succOffsets: Int32Array;
+  private readonly succEdges: Int32Array;
+  private readonly predOffsets: Int32Array;
+  private readonly predEdges: Int32Array;
+
+  private readonly entryIndices: Int32Array;
+
+  private cachedReversePostorder: Int32Array | null = null;
+  private cachedImmediateDominators: Int32Array | null = null;
+
+  constructor(blocks: Map<string, BasicBlock>, entryPoints: Set<string>) {
+    // Dense numbering in ascending start-address order, so block index
+    // order matches address order and binary search works on addresses
+    const ordered = Array.from(blocks.values()).sort((a, b) => a.startAddress - b.startAddress);
+    const n = ordered.length;
+
+    this.blockIds = new Array(n);
+    this.idToIndex = new Map();
+    this.startAddresses = new Int32Array(n);
+    this.endAddresses = new Int32Array(n);
+
+    for (let i = 0; i < n; i++) {
+      this.blockIds[i] = ordered[i].id;
+      this.idToIndex.set(ordered[i].id, i);
+      this.startAddresses[i] = ordered[i].startAddress;
+      this.endAddresses[i] = ordered[i].endAddress;
+    }
+
+    // CSR construction: count degrees, prefix-sum into offsets, then fill
+    this.succOffsets = new Int32Array(n + 1);
+    this.predOffsets = new Int32Array(n + 1);
+    for (let i = 0; i < n; i++) {
+      this.succOffsets[i + 1] = this.succOffsets[i] + ordered[i].successors.size;
+      this.predOffsets[i + 1] = this.predOffsets[i] + ordered[i].predecessors.size;
+    }
+
+    this.succEdges = new Int32Array(this.succOffsets[n]);
+    this.predEdges = new Int32Array(this.predOffsets[n]);
+
+    for (let i = 0; i < n; i++) {
+      let succCursor = this.succOffsets[i];
+      for (const id of ordered[i].successors) {
+        this.succEdges[succCursor++] = this.idToIndex.get(id) ?? -1;
+      }
+      let predCursor = this.predOffsets[i];
+      for (const id of ordered[i].predecessors) {
+        this.predEdges[predCursor++] = this.idToIndex.get(id) ?? -1;
+      }
+    }
+
+    const entries: number[] = [];
+    for (const id of entryPoints) {
+      const index = this.idToIndex.get(id);
+      if (index !== undefined) {
+        entries.push(index);
+      }
+    }
+    this.entryIndices = Int32Array.from(entries.sort((a, b) => a - b));
+  }
+
+  get blockCount(): number {
+    return this.blockIds.length;
+  }
+
+  /** Dense index of a block id, or -1 if unknown */
+  indexOf(blockId: string): number {
+    return this.idToIndex.get(blockId) ?? -1;
+  }
+
+  blockIdAt(index: number): string {
+    return this.blockIds[index];
+  }
+
+  startAddressAt(index: number): number {
+    return this.startAddresses[index];
+  }
+
+  endAddressAt(index: number): number {
+    return this.endAddresses[index];
+  }
+
+  entries(): Int32Array {
+    return this.entryIndices;
+  }
+
+  /** Successor indices of a block as a typed-array view (do not mutate) */
+  successorsOf(index: number): Int32Array {
+    return this.succEdges.subarray(this.succOffsets[index], this.succOffsets[index + 1]);
+  }
+
+  /** Predecessor indices of a block as a typed-array view (do not mutate) */
+  predecessorsOf(index: number): Int32Array {
+    return this.predEdges.subarray(this.predOffsets[index], this.predOffsets[index + 1]);
+  }
+
+  /** Block containing the address, or -1; binary search over start order */
+  blockIndexForAddress(address: number): number {
+    let lo = 0;
+    let hi = this.blockIds.length - 1;
+    let candidate = -1;
+    while (lo <= hi) {
+      const mid = (lo + hi) >> 1;
+      if (this.startAddresses[mid] <= address) {
+        candidate = mid;
+        lo = mid + 1;
+      } else {
+        hi = mid - 1;
+      }
+    }
+    return candidate >= 0 && address <= this.endAddresses[candidate] ? candidate : -1;
+  }
+
+  /**
+   * Reverse postorder over blocks reachable from the entry points,
+   * computed once and cached. Blocks unreachable from every entry are
+   * absent; their reachability can be tested via postorderNumberOf().
+   */
+  reversePostorder(): Int32Array {
+    if (this.cachedReversePostorder) {
+      return this.cachedReversePostorder;
+    }
+
+    const n = this.blockIds.length;
+    const visited = new Uint8Array(n);
+    const postorder: number[] = [];
+
+    // Iterative DFS with an explicit edge-cursor stack; recursion would
+    // overflow on long fall-through chains
+    const stack: number[] = [];
+    const cursor = new Int32Array(n);
+
+    for (const entry of this.entryIndices) {
+      if (visited[entry]) {
+        continue;
+      }
+      visited[entry] = 1;
+      stack.push(entry);
+
+      while (stack.length > 0) {
+        const block = stack[stack.length - 1];
+        const succs = this.successorsOf(block);
+        let advanced = false;
+
+        while (cursor[block] < succs.length) {
+          const next = succs[cursor[block]++];
+          if (next >= 0 && !visited[next]) {
+            visited[next] = 1;
+            stack.push(next);
+            advanced = true;
+            break;
+          }
+        }
+
+        if (!advanced) {
+          postorder.push(block);
+          stack.pop();
+        }
+      }
+    }
+
+    const rpo = new Int32Array(postorder.length);
+    for (let i = 0; i < postorder.length; i++) {
+      rpo[i] = postorder[postorder.length - 1 - i];
+    }
+
+    this.cachedReversePostorder = rpo;
+    return rpo;
+  }
+
+  /**
+   * Immediate dominators, computed once with the iterative
+   * Cooper-Harvey-Kennedy algorithm over the cached reverse postorder.
+   * Multiple entry points are handled through a virtual root, so
+   * idom[entry] === entry; unreachable blocks report -1.
+   */
+  immediateDominators(): Int32Array {
+    if (this.cachedImmediateDominators) {
+      return this.cachedImmediateDominators;
+    }
+
+    const n = this.blockIds.length;
+    const rpo = this.reversePostorder();
+
+    const rpoNumber = new Int32Array(n).fill(-1);
+    for (let i = 0; i < rpo.length; i++) {
+      rpoNumber[rpo[i]] = i;
+    }
+
+    // Virtual root index n: the single predecessor of every entry point
+    const ROOT = n;
+    const idom = new Int32Array(n + 1).fill(-1);
+    idom[ROOT] = ROOT;
+    const isEntry = new Uint8Array(n);
+    for (const entry of this.entryIndices) {
+      isEntry[entry] = 1;
+    }
+
+    const intersect = (a: number, b: number): number => {
+      while (a !== b) {
+        // The root has the smallest implicit RPO number (-1)
+        while (a !== ROOT && (b === ROOT || rpoNumber[a] > rpoNumber[b])) {
+          a = idom[a];
+        }
+        while (b !== ROOT && (a === ROOT || rpoNumber[b] > rpoNumber[a])) {
+          b = idom[b];
+        }
+      }
+      return a;
+    };
+
+    let changed = true;
+    while (changed) {
+      changed = false;
+      for (const block of rpo) {
+        let newIdom = isEntry[block] ? ROOT : -1;
+        for (const pred of this.predecessorsOf(block)) {
+          if (pred >= 0 && idom[pred] !== -1 && rpoNumber[pred] !== -1) {
+            newIdom = newIdom === -1 ? pred : intersect(newIdom, pred);
+          }
+        }
+        if (newIdom !== -1 && idom[block] !== newIdom) {
+          idom[block] = newIdom;
+          changed = true;
+        }
+      }
+    }
+
+    // Report entries (and anything directly under the virtual root) as
+    // self-dominated; drop the root slot
+    const result = new Int32Array(n);
+    for (let i = 0; i < n; i++) {
+      result[i] = idom[i] === ROOT ? i : idom[i];
+    }
+
+    this.cachedImmediateDominators = result;
+    return result;
+  }
+
+  /** Whether block a dominates block b (every block dominates itself) */
+  dominates(a: number, b: number): boolean {
+    const idom = this.immediateDominators();
+    if (idom[b] === -1) {
+      return false;
+    }
+    let walk = b;
+    while (walk !== a && idom[walk] !== walk) {
+      walk = idom[walk];
+      if (walk === -1) {
+        return false;
+      }
+    }
+    return walk === a;
+  }
+
+  /** Whether the block is reachable from any entry point */
+  isReachable(index: number): boolean {
+    const idom = this.immediateDominators();
+    return idom[index] !== -1;
+  }
+}
+
+/**
+ * Precompiled Aho-Corasick automaton over interned mnemonic IDs.
+ *
+ * The prologue and table detectors used to compare mnemonic string
+ * sequences against every pattern at every line offset - an
+ * O(lines x patterns x patternLength) string-comparison loop. Here each
+ * pattern mnemonic is interned to a small integer when the automaton is
+ * compiled, and matching is a single integer-state walk over the line
+ * stream: one Map lookup per line plus failure-link transitions, emitting
+ * every pattern occurrence (including overlaps) at its end position.
+ */
+class MnemonicPatternAutomaton {
+  private mnemonicIds = new Map<string, number>();
+  private transitions: Array<Map<number, number>> = [new Map()];
+  private failureLinks: number[] = [0];
+  private outputs: number[][] = [[]];
+  private patternLengths: number[] = [];
+
+  constructor(patterns: ReadonlyArray<ReadonlyArray<string>>) {
+    // Trie construction over interned IDs
+    for (const pattern of patterns) {
+      let state = 0;
+      for (const mnemonic of pattern) {
+        const id = this.intern(mnemonic);
+        let next = this.transitions[state].get(id);
+        if (next === undefined) {
+          next = this.transitions.length;
+          this.transitions.push(new Map());
+          this.failureLinks.push(0);
+          this.outputs.push([]);
+          this.transitions[state].set(id, next);
+        }
+        state = next;
+      }
+      this.outputs[state].push(this.patternLengths.length);
+      this.patternLengths.push(pattern.length);
+    }
+
+    // Breadth-first failure-link construction; shallower states are always
+    // processed first, so failure targets are complete when merged
+    const queue: number[] = Array.from(this.transitions[0].values());
+    while (queue.length > 0) {
+      const state = queue.shift()!;
+      for (const [id, next] of this.transitions[state]) {
+        queue.push(next);
+        let fallback = this.failureLinks[state];
+        while (fallback !== 0 && !this.transitions[fallback].has(id)) {
+          fallback = this.failureLinks[fallback];
+        }
+        this.failureLinks[next] = this.transitions[fallback].get(id) ?? 0;
+        this.outputs[next].push(...this.outputs[this.failureLinks[next]]);
+      }
+    }
+  }
+
+  private intern(mnemonic: string): number {
+    let id = this.mnemonicIds.get(mnemonic);
+    if (id === undefined) {
+      id = this.mnemonicIds.size;
+      this.mnemonicIds.set(mnemonic, id);
+    }
+    return id;
+  }
+
+  /** Advance one symbol; mnemonics outside every pattern reset to the root */
+  step(state: number, mnemonic: string): number {
+    const id = this.mnemonicIds.get(mnemonic);
+    if (id === undefined) {
+      return 0;
+    }
+    while (state !== 0 && !this.transitions[state].has(id)) {
+      state = this.failureLinks[state];
+    }
+    return this.transitions[state].get(id) ?? 0;
+  }
+
+  /** Pattern indices whose last symbol is the one just consumed */
+  outputsAt(state: number): ReadonlyArray<number> {
+    return this.outputs[state];
+  }
+
+  lengthOf(patternIndex: number): number {
+    return this.patternLengths[patternIndex];
+  }
+
+  /** Scan the line stream once, invoking onMatch(patternIndex, startIndex) */
+  scan(lines: DisassemblyLine[], onMatch: (patternIndex: number, startIndex: number) => void): void {
+    let state = 0;
+    for (let i = 0; i < lines.length; i++) {
+      state = this.step(state, lines[i].instruction.mnemonic);
+      const matched = this.outputs[state];
+      for (let m = 0; m < matched.length; m++) {
+        onMatch(matched[m], i - this.patternLengths[matched[m]] + 1);
+      }
+    }
+  }
+}
+
+// Common SNES function prologue patterns, compiled once into the shared
+// automaton. Indices 0..N-1 identify prologues; the trailing entry is the
+// pointer-table mnemonic skeleton, whose matches still get verified
+// against addressing modes and operand adjacency.
+const PROLOGUE_PATTERNS: string[][] = [
+  ['PHB', 'PHK', 'PLB'], // Bank switching prologue
+  ['REP', 'SEP'],        // Processor flag setup
+  ['PHA', 'PHX', 'PHY'], // Register preservation
+  ['PHP']                // Processor status preservation
+];
+const POINTER_TABLE_SKELETON = ['LDA', 'STA', 'LDA', 'STA'];
+const POINTER_SKELETON_INDEX = PROLOGUE_PATTERNS.length;
+const SEQUENCE_AUTOMATON = new MnemonicPatternAutomaton([...PROLOGUE_PATTERNS, POINTER_TABLE_SKELETON]);
+
+/**
+ * Per-line visitor for the fused analysis pipeline (analyzeFused).
+ * visit() is called exactly once per line during the single traversal;
+ * finalize() runs after the traversal so visitors can resolve state that
+ * needs the full pass (e.g. forward-reference targets).
+ */
+export interface LineVisitor {
+  name: string;
+  visit(line: DisassemblyLine, index: number, lines: DisassemblyLine[]): void;
+  finalize?(): void;
+}
+
 export class AnalysisEngine {
   private cfg: ControlFlowGraph;
   private symbols: Map<number, SymbolInfo>;
@@ -109,6 +641,10 @@ export class AnalysisEngine {
   private pointerTables: Map<number, PointerTable>;
   private spriteData: Map<number, SpriteDataInfo>;
   private registerUsage: Map<number, HardwareRegisterUsage>;
+  private customVisitors: LineVisitor[] = [];
+  private addressIndex: AddressIndex | null = null;
+  private compactCfg: CompactControlFlowGraph | null = null;
+  private lastAnalyzedLines: DisassemblyLine[] | null = null;
 
   constructor() {
     this.cfg = {
@@ -130,46 +666,585 @@ export class AnalysisEngine {
    * Perform comprehensive analysis on disassembled code
    */
   public analyze(lines: DisassemblyLine[], cartridgeInfo: CartridgeInfo, vectorAddresses?: number[]): void {
+    // Phase 0: Build the shared address index all passes consult
+    this.addressIndex = new AddressIndex(lines);
+
     // Phase 1: Basic block detection
-    const blocks = this.detectBasicBlocks(lines);
+    let blocks: BasicBlock[] = [];
+    this.timedPass(PASS_TIMERS.basicBlocks, () => {
+      blocks = this.detectBasicBlocks(lines);
+    });
 
-    // Phase 2: Control flow analysis
-    this.buildControlFlowGraph(blocks, lines);
+    // Phase 2: Control flow analysis, plus the compact integer-indexed
+    // view downstream consumers traverse
+    this.timedPass(PASS_TIMERS.controlFlow, () => {
+      this.buildControlFlowGraph(blocks, lines);
+      this.compactCfg = new CompactControlFlowGraph(this.cfg.blocks, this.cfg.entryPoints);
+    });
 
     // Phase 3: Function boundary detection
-    this.detectFunctions(lines, cartridgeInfo, vectorAddresses);
+    this.timedPass(PASS_TIMERS.functions, () => this.detectFunctions(lines, cartridgeInfo, vectorAddresses));
 
     // Phase 4: Data structure recognition
-    this.analyzeDataStructures(lines);
+    this.timedPass(PASS_TIMERS.dataStructures, () => this.analyzeDataStructures(lines));
 
     // Phase 5: Cross-reference building
-    this.buildCrossReferences(lines);
+    this.timedPass(PASS_TIMERS.crossReferences, () => this.buildCrossReferences(lines));
 
     // Phase 6: Symbol generation
-    this.generateSymbols(lines);
+    this.timedPass(PASS_TIMERS.symbols, () => this.generateSymbols(lines));
 
     // Phase 7: Hardware register analysis
-    this.analyzeHardwareRegisterUsage(lines);
+    this.timedPass(PASS_TIMERS.hardwareRegisters, () => this.analyzeHardwareRegisterUsage(lines));
 
     // Phase 8: Advanced control flow analysis
-    this.performRecursiveDescentAnalysis(lines);
+    this.timedPass(PASS_TIMERS.recursiveDescent, () => this.performRecursiveDescentAnalysis(lines));
 
     // Phase 9: String and audio data detection
-    this.detectStringData(lines);
-    this.detectAudioData(lines);
+    this.timedPass(PASS_TIMERS.stringAudio, () => {
+      this.detectStringData(lines);
+      this.detectAudioData(lines);
+    });
 
     // Phase 10: Data flow and symbol analysis
-    this.performDataFlowAnalysis(lines);
-    this.performSymbolDependencyAnalysis();
+    this.timedPass(PASS_TIMERS.dataFlow, () => {
+      this.performDataFlowAnalysis(lines);
+      this.performSymbolDependencyAnalysis();
+    });
 
     // Phase 11: Macro and inline function detection
-    this.detectMacrosAndInlineFunctions(lines);
+    this.timedPass(PASS_TIMERS.macros, () => this.detectMacrosAndInlineFunctions(lines));
 
     // Phase 12: Game-specific pattern recognition
-    this.detectGameSpecificPatterns(lines, cartridgeInfo);
+    this.timedPass(PASS_TIMERS.gamePatterns, () => this.detectGameSpecificPatterns(lines, cartridgeInfo));
 
     // Phase 13: Code quality metrics calculation
-    this.calculateCodeQualityMetrics(lines);
+    this.timedPass(PASS_TIMERS.qualityMetrics, () => this.calculateCodeQualityMetrics(lines));
+
+    this.lastAnalyzedLines = lines;
+  }
+
+  /** Run one analysis pass under its instrumentation timer */
+  private timedPass(timerId: number, pass: () => void): void {
+    const start = instrumentation.timeStart(timerId);
+    pass();
+    instrumentation.timeEnd(timerId, start);
+  }
+
+  /**
+   * Incrementally re-run analysis for the given changed address ranges.
+   *
+   * Interactive edits (a renamed label, an added comment, a re-decoded
+   * region) touch a handful of addresses, but analyze() walks every phase
+   * over every line again. This entry point finds the basic blocks
+   * overlapping the changed ranges plus their CFG predecessors and
+   * successors, rebuilds only their instruction slices and outgoing edges,
+   * and patches the crossReferences and symbols maps in place. Falls back
+   * to a full analyze() when no prior analysis exists.
+   */
+  public reanalyzeRanges(lines: DisassemblyLine[], cartridgeInfo: CartridgeInfo, changedRanges: AddressRange[]): void {
+    if (this.lastAnalyzedLines === null || this.cfg.blocks.size === 0) {
+      this.analyze(lines, cartridgeInfo);
+      return;
+    }
+    if (changedRanges.length === 0) {
+      return;
+    }
+
+    // Refresh the shared index - changed lines may carry new operands
+    this.addressIndex = new AddressIndex(lines);
+
+    // Collect blocks overlapping the changed ranges
+    const dirtyBlocks = new Map<string, BasicBlock>();
+    for (const block of this.cfg.blocks.values()) {
+      for (const range of changedRanges) {
+        if (block.startAddress <= range.end && block.endAddress >= range.start) {
+          dirtyBlocks.set(block.id, block);
+          break;
+        }
+      }
+    }
+
+    // Expand to CFG neighbors so edge changes propagate one hop
+    for (const block of Array.from(dirtyBlocks.values())) {
+      for (const neighborId of [...block.predecessors, ...block.successors]) {
+        const neighbor = this.cfg.blocks.get(neighborId);
+        if (neighbor) {
+          dirtyBlocks.set(neighborId, neighbor);
+        }
+      }
+    }
+
+    if (dirtyBlocks.size === 0) {
+      this.lastAnalyzedLines = lines;
+      return;
+    }
+
+    const allBlocks = Array.from(this.cfg.blocks.values());
+    const isDirtyAddress = (address: number): boolean => {
+      for (const block of dirtyBlocks.values()) {
+        if (address >= block.startAddress && address <= block.endAddress) {
+          return true;
+        }
+      }
+      return false;
+    };
+
+    // Rebuild each dirty block from the current lines and redo its edges
+    for (const block of dirtyBlocks.values()) {
+      block.instructions = this.collectLinesInRange(lines, block.startAddress, block.endAddress);
+      if (block.instructions.length === 0) {
+        continue;
+      }
+      block.isFunction = this.isLikelyFunctionStart(block.instructions[0], lines);
+      block.isFunctionEnd = this.isFunctionEnd(block.instructions[block.instructions.length - 1]);
+
+      // Detach stale outgoing edges before recomputing them
+      for (const successorId of block.successors) {
+        const successor = this.cfg.blocks.get(successorId);
+        if (successor) {
+          successor.predecessors.delete(block.id);
+        }
+      }
+      block.successors.clear();
+
+      const lastInstruction = block.instructions[block.instructions.length - 1];
+      if (this.isControlFlowInstruction(lastInstruction.instruction.mnemonic)) {
+        this.addControlFlowEdges(block, lastInstruction, allBlocks);
+      } else {
+        this.addSequentialEdge(block, allBlocks);
+      }
+    }
+
+    // Patch cross-references: drop entries sourced from dirty blocks, then
+    // re-add from the refreshed instruction slices
+    for (const [address, refs] of this.crossReferences) {
+      const kept = refs.filter(ref => !isDirtyAddress(ref.fromAddress));
+      if (kept.length === 0) {
+        this.crossReferences.delete(address);
+      } else if (kept.length !== refs.length) {
+        this.crossReferences.set(address, kept);
+      }
+    }
+    for (const block of dirtyBlocks.values()) {
+      for (const line of block.instructions) {
+        if (line.operand === undefined) {
+          continue;
+        }
+        const xref: CrossReference = {
+          address: line.operand,
+          type: this.getCrossReferenceType(line.instruction.mnemonic, line.instruction.addressingMode),
+          fromAddress: line.address,
+          instruction: `${line.instruction.mnemonic} ${this.formatOperand(line)}`
+        };
+        if (!this.crossReferences.has(line.operand)) {
+          this.crossReferences.set(line.operand, []);
+        }
+        this.crossReferences.get(line.operand)!.push(xref);
+      }
+    }
+
+    // Patch symbols: refresh reference lists and (re)generate entries for
+    // addresses inside the dirty blocks
+    for (const symbol of this.symbols.values()) {
+      symbol.references = this.crossReferences.get(symbol.address) || [];
+    }
+    for (const block of dirtyBlocks.values()) {
+      const func = this.cfg.functions.get(block.startAddress);
+      if (block.isFunction && func && !this.symbols.has(block.startAddress)) {
+        this.symbols.set(block.startAddress, {
+          address: block.startAddress,
+          name: this.generateFunctionName(block.startAddress, func),
+          type: 'FUNCTION',
+          references: this.crossReferences.get(block.startAddress) || [],
+          confidence: func.confidence
+        });
+      }
+      for (const line of block.instructions) {
+        if (line.operand !== undefined && this.hardwareRegisters.has(line.operand) && !this.symbols.has(line.operand)) {
+          const registerInfo = getRegisterInfo(line.operand);
+          this.symbols.set(line.operand, {
+            address: line.operand,
+            name: registerInfo.name || this.hardwareRegisters.get(line.operand)!,
+            type: 'CONSTANT',
+            references: this.crossReferences.get(line.operand) || [],
+            confidence: 1.0,
+            description: registerInfo.description
+          });
+        }
+      }
+    }
+
+    // Edges changed, so the compact view and its cached orders are stale
+    this.compactCfg = new CompactControlFlowGraph(this.cfg.blocks, this.cfg.entryPoints);
+
+    this.lastAnalyzedLines = lines;
+  }
+
+  /**
+   * Slice out the lines inside [start, end]; lines are address-ordered so
+   * the lower bound is found by binary search
+   */
+  private collectLinesInRange(lines: DisassemblyLine[], start: number, end: number): DisassemblyLine[] {
+    let lo = 0;
+    let hi = lines.length;
+    while (lo < hi) {
+      const mid = (lo + hi) >> 1;
+      if (lines[mid].address < start) lo = mid + 1;
+      else hi = mid;
+    }
+
+    const collected: DisassemblyLine[] = [];
+    for (let i = lo; i < lines.length && lines[i].address <= end; i++) {
+      collected.push(lines[i]);
+    }
+    return collected;
+  }
+
+  /**
+   * Register an additional per-line visitor to run inside analyzeFused()
+   */
+  public registerVisitor(visitor: LineVisitor): void {
+    this.customVisitors.push(visitor);
+  }
+
+  /**
+   * Fused single-pass version of the core structural analysis.
+   *
+   * analyze() makes a separate full pass over the lines array for each phase
+   * (block detection, function heuristics, table patterns, xrefs, symbols,
+   * register usage), which dominates analysis time on large ROMs. This mode
+   * collects everything those phases need in ONE traversal - block
+   * boundaries, branch/JSR targets, cross-references, register usage, table
+   * and prologue pattern matches, plus any visitors registered via
+   * registerVisitor() - then resolves the graph, functions, data structures
+   * and symbols from the collected state without rescanning lines.
+   *
+   * Covers phases 1-7 of analyze(); the deeper semantic passes (recursive
+   * descent, data flow, game-specific patterns) remain multi-pass only.
+   */
+  public analyzeFused(lines: DisassemblyLine[], cartridgeInfo: CartridgeInfo, vectorAddresses?: number[]): void {
+    // ---- Collection state shared by the fused visitors ----
+    const blockStarts = new Set<number>();
+    const blockEnds = new Set<number>();
+    const branchTargets = new Set<number>();
+    const jsrTargets = new Set<number>();
+    const jsrCalls: Array<{ from: number; target: number }> = [];
+    const deadCodeCandidates: number[] = [];
+    const hardwareOperands = new Set<number>();
+    const operandValues: number[] = [];
+    const pendingTables: Array<{ address: number; type: 'POINTER_TABLE' | 'JUMP_TABLE' | 'GRAPHICS_DATA' | 'MUSIC_DATA'; confidence: number; bytesPerEntry: number }> = [];
+    const prologueStarts = new Set<number>();
+
+    const graphicsRegisters = [0x2118, 0x2119, 0x2122, 0x2104];
+    const apuRegisters = [0x2140, 0x2141, 0x2142, 0x2143];
+    let automatonState = 0;
+
+    this.crossReferences.clear();
+    this.registerUsage.clear();
+
+    // ---- Single traversal ----
+    for (let i = 0; i < lines.length; i++) {
+      const line = lines[i];
+      const mnemonic = line.instruction.mnemonic;
+      automatonState = SEQUENCE_AUTOMATON.step(automatonState, mnemonic);
+
+      // Block boundary collection (phase 1)
+      if (i === 0 || this.isEntryPoint(line.address)) {
+        blockStarts.add(line.address);
+      }
+      if (this.isControlFlowInstruction(mnemonic)) {
+        blockEnds.add(line.address);
+        if (line.operand !== undefined && this.isBranchOrJump(mnemonic)) {
+          blockStarts.add(line.operand);
+          if (this.isConditionalBranch(mnemonic) && i + 1 < lines.length) {
+            blockStarts.add(lines[i + 1].address);
+          }
+        }
+      }
+
+      // Branch/jump target collection replaces the per-line isJumpTarget scans
+      if (line.operand !== undefined && this.isBranchOrJump(mnemonic)) {
+        branchTargets.add(line.operand);
+      }
+
+      // Function heuristics (phase 3)
+      if (mnemonic === 'JSR' && line.operand !== undefined) {
+        jsrTargets.add(line.operand);
+        jsrCalls.push({ from: line.address, target: line.operand });
+      }
+      for (const patternIndex of SEQUENCE_AUTOMATON.outputsAt(automatonState)) {
+        const startIndex = i - SEQUENCE_AUTOMATON.lengthOf(patternIndex) + 1;
+        if (patternIndex < POINTER_SKELETON_INDEX) {
+          if (startIndex < lines.length - 2) {
+            prologueStarts.add(lines[startIndex].address);
+          }
+        } else if (this.isPointerTablePattern(lines.slice(startIndex, startIndex + 4))) {
+          const tableAddr = lines[startIndex].operand;
+          if (tableAddr !== undefined) {
+            pendingTables.push({ address: tableAddr, type: 'POINTER_TABLE', confidence: 0.7, bytesPerEntry: 2 });
+          }
+        }
+      }
+      if (i < lines.length - 1 && ['JMP', 'BRA', 'BRL', 'RTS', 'RTI', 'RTL'].includes(mnemonic)) {
+        deadCodeCandidates.push(lines[i + 1].address);
+      }
+
+      // Cross-reference collection (phase 5)
+      if (line.operand !== undefined) {
+        operandValues.push(line.operand);
+        const xref: CrossReference = {
+          address: line.operand,
+          type: this.getCrossReferenceType(mnemonic, line.instruction.addressingMode),
+          fromAddress: line.address,
+          instruction: `${mnemonic} ${this.formatOperand(line)}`
+        };
+        let refs = this.crossReferences.get(line.operand);
+        if (!refs) {
+          refs = [];
+          this.crossReferences.set(line.operand, refs);
+        }
+        refs.push(xref);
+      }
+
+      // Hardware register usage (phase 7)
+      if (line.operand !== undefined) {
+        const registerName = this.hardwareRegisters.get(line.operand);
+        if (registerName) {
+          hardwareOperands.add(line.operand);
+          let usage = this.registerUsage.get(line.operand);
+          if (!usage) {
+            usage = {
+              register: registerName,
+              address: line.operand,
+              reads: 0,
+              writes: 0,
+              accessPoints: [],
+              description: this.getRegisterDescription(line.operand)
+            };
+            this.registerUsage.set(line.operand, usage);
+          }
+          if (this.isWriteOperation(mnemonic)) {
+            usage.writes++;
+          } else {
+            usage.reads++;
+          }
+          usage.accessPoints.push(line.address);
+        }
+      }
+
+      // Table pattern matching (phase 4) - pointer tables come from the
+      // automaton outputs above; the single-instruction patterns stay inline
+      if (mnemonic === 'JMP' &&
+          (line.instruction.addressingMode === AddressingMode.AbsoluteIndirect ||
+           line.instruction.addressingMode === AddressingMode.AbsoluteIndexedIndirect) &&
+          line.operand !== undefined) {
+        pendingTables.push({ address: line.operand, type: 'JUMP_TABLE', confidence: 0.7, bytesPerEntry: 2 });
+      }
+      if (mnemonic === 'STA' && line.operand !== undefined && graphicsRegisters.includes(line.operand)) {
+        for (let j = i - 1; j >= Math.max(0, i - 5); j--) {
+          const prevLine = lines[j];
+          if (prevLine.instruction.mnemonic === 'LDA' &&
+              prevLine.instruction.addressingMode === AddressingMode.AbsoluteX &&
+              prevLine.operand !== undefined) {
+            pendingTables.push({ address: prevLine.operand, type: 'GRAPHICS_DATA', confidence: 0.6, bytesPerEntry: 1 });
+            break;
+          }
+        }
+      }
+      if (mnemonic === 'STA' && line.operand !== undefined && apuRegisters.includes(line.operand)) {
+        for (let j = i - 1; j >= Math.max(0, i - 3); j--) {
+          const prevLine = lines[j];
+          if (prevLine.instruction.mnemonic === 'LDA' &&
+              prevLine.operand !== undefined &&
+              !apuRegisters.includes(prevLine.operand)) {
+            pendingTables.push({ address: prevLine.operand, type: 'MUSIC_DATA', confidence: 0.5, bytesPerEntry: 1 });
+            break;
+          }
+        }
+      }
+
+      // External visitors registered via registerVisitor()
+      for (const visitor of this.customVisitors) {
+        visitor.visit(line, i, lines);
+      }
+    }
+
+    // ---- Resolution from collected state (no further line scans) ----
+    for (const visitor of this.customVisitors) {
+      visitor.finalize?.();
+    }
+
+    // Functions: vectors, JSR targets, prologues, dead-code boundaries
+    const functions = new Map<number, FunctionInfo>();
+    this.detectVectorFunctions(cartridgeInfo, functions, vectorAddresses);
+    for (const { from, target } of jsrCalls) {
+      let func = functions.get(target);
+      if (!func) {
+        func = {
+          startAddress: target,
+          callers: new Set(),
+          callees: new Set(),
+          basicBlocks: new Set(),
+          isInterrupt: false,
+          confidence: 0.9
+        };
+        functions.set(target, func);
+      }
+      func.callers.add(from);
+      for (const [addr, callerFunc] of functions) {
+        if (from >= addr && (callerFunc.endAddress === undefined || from <= callerFunc.endAddress)) {
+          callerFunc.callees.add(target);
+          break;
+        }
+      }
+    }
+    for (const addr of prologueStarts) {
+      if (!functions.has(addr)) {
+        functions.set(addr, {
+          startAddress: addr,
+          callers: new Set(),
+          callees: new Set(),
+          basicBlocks: new Set(),
+          isInterrupt: false,
+          confidence: 0.7
+        });
+      }
+    }
+    for (const addr of deadCodeCandidates) {
+      if (!branchTargets.has(addr) && !functions.has(addr)) {
+        functions.set(addr, {
+          startAddress: addr,
+          callers: new Set(),
+          callees: new Set(),
+          basicBlocks: new Set(),
+          isInterrupt: false,
+          confidence: 0.6
+        });
+      }
+    }
+    // Data structures, with table sizes estimated from the operand histogram
+    const sortedOperands = operandValues.sort((a, b) => a - b);
+    for (const pending of pendingTables) {
+      if (pending.type === 'MUSIC_DATA' && this.dataStructures.has(pending.address)) {
+        continue;
+      }
+      const size = this.estimateTableSizeFromOperands(sortedOperands, pending.address);
+      const label = pending.type === 'POINTER_TABLE' ? 'Pointer table' :
+        pending.type === 'JUMP_TABLE' ? 'Jump table' :
+          pending.type === 'GRAPHICS_DATA' ? 'Graphics data' : 'Music/Audio data';
+      this.dataStructures.set(pending.address, {
+        address: pending.address,
+        type: pending.type,
+        size,
+        entries: Math.floor(size / pending.bytesPerEntry),
+        description: `${label} at $${pending.address.toString(16).toUpperCase()}`,
+        confidence: pending.confidence
+      });
+    }
+
+    // Basic blocks: walk the line array once against the sorted boundary set
+    const blocks = this.buildBlocksFromBoundaries(lines, blockStarts, jsrTargets);
+    this.buildControlFlowGraph(blocks, lines);
+    this.cfg.functions = functions;
+
+    // Symbols from functions, data structures and collected register operands
+    this.symbols.clear();
+    for (const [address, func] of this.cfg.functions) {
+      this.symbols.set(address, {
+        address,
+        name: this.generateFunctionName(address, func),
+        type: 'FUNCTION',
+        references: this.crossReferences.get(address) || [],
+        confidence: func.confidence
+      });
+    }
+    for (const [address, dataStruct] of this.dataStructures) {
+      this.symbols.set(address, {
+        address,
+        name: this.generateDataName(address, dataStruct),
+        type: 'DATA',
+        size: dataStruct.size,
+        references: this.crossReferences.get(address) || [],
+        confidence: 0.8
+      });
+    }
+    for (const address of hardwareOperands) {
+      if (!this.symbols.has(address)) {
+        const registerInfo = getRegisterInfo(address);
+        this.symbols.set(address, {
+          address,
+          name: registerInfo.name || this.hardwareRegisters.get(address)!,
+          type: 'CONSTANT',
+          references: this.crossReferences.get(address) || [],
+          confidence: 1.0,
+          description: registerInfo.description
+        });
+      }
+    }
+
+    this.lastAnalyzedLines = lines;
+  }
+
+  /**
+   * Build basic blocks by walking sorted lines once against the collected
+   * boundary set, instead of filtering the full array per block
+   */
+  private buildBlocksFromBoundaries(lines: DisassemblyLine[], blockStarts: Set<number>, jsrTargets: Set<number>): BasicBlock[] {
+    const blocks: BasicBlock[] = [];
+    let current: DisassemblyLine[] = [];
+
+    const flush = (): void => {
+      if (current.length === 0) return;
+      const first = current[0];
+      const last = current[current.length - 1];
+      blocks.push({
+        id: `block_${first.address.toString(16)}`,
+        startAddress: first.address,
+        endAddress: last.address,
+        instructions: current,
+        predecessors: new Set(),
+        successors: new Set(),
+        isFunction: jsrTargets.has(first.address),
+        isFunctionEnd: this.isFunctionEnd(last)
+      });
+      current = [];
+    };
+
+    for (const line of lines) {
+      if (blockStarts.has(line.address)) {
+        flush();
+      }
+      current.push(line);
+    }
+    flush();
+
+    return blocks;
+  }
+
+  /**
+   * Estimate a table's size from the sorted operand histogram collected
+   * during the fused pass (replaces per-table full scans)
+   */
+  private estimateTableSizeFromOperands(sortedOperands: number[], tableAddr: number): number {
+    // Binary search for the first operand >= tableAddr
+    let lo = 0;
+    let hi = sortedOperands.length;
+    while (lo < hi) {
+      const mid = (lo + hi) >> 1;
+      if (sortedOperands[mid] < tableAddr) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+
+    let maxOffset = 0;
+    for (let i = lo; i < sortedOperands.length && sortedOperands[i] - tableAddr < 256; i++) {
+      maxOffset = Math.max(maxOffset, sortedOperands[i] - tableAddr);
+    }
+
+    return Math.max(16, Math.min(256, maxOffset + 16));
   }
 
   /**
@@ -445,6 +1520,9 @@ export class AnalysisEngine {
 
   private isLikelyFunctionStart(line: DisassemblyLine, allLines: DisassemblyLine[]): boolean {
     // Check if this address is a JSR target
+    if (this.addressIndex) {
+      return this.addressIndex.isJsrTarget(line.address);
+    }
     return allLines.some(l =>
       l.instruction.mnemonic === 'JSR' && l.operand === line.address
     );
@@ -456,6 +1534,9 @@ export class AnalysisEngine {
   }
 
   private isJumpTarget(address: number, lines: DisassemblyLine[]): boolean {
+    if (this.addressIndex) {
+      return this.addressIndex.isBranchTarget(address);
+    }
     return lines.some(line =>
       this.isBranchOrJump(line.instruction.mnemonic) && line.operand === address
     );
@@ -518,9 +1599,23 @@ export class AnalysisEngine {
   }
 
   private findBlockByAddress(address: number, blocks: BasicBlock[]): BasicBlock | undefined {
-    return blocks.find(block =>
-      address >= block.startAddress && address <= block.endAddress
-    );
+    // Blocks are created in ascending start-address order, so the containing
+    // block (if any) is the last one starting at or before the address
+    let lo = 0;
+    let hi = blocks.length - 1;
+    let candidate: BasicBlock | undefined;
+
+    while (lo <= hi) {
+      const mid = (lo + hi) >> 1;
+      if (blocks[mid].startAddress <= address) {
+        candidate = blocks[mid];
+        lo = mid + 1;
+      } else {
+        hi = mid - 1;
+      }
+    }
+
+    return candidate && address <= candidate.endAddress ? candidate : undefined;
   }
 
   private detectVectorFunctions(cartridgeInfo: CartridgeInfo, functions: Map<number, FunctionInfo>, vectorAddresses?: number[]): void {
@@ -575,49 +1670,26 @@ export class AnalysisEngine {
   }
 
   private detectProloguePatterns(lines: DisassemblyLine[], functions: Map<number, FunctionInfo>): void {
-    // Common SNES function prologue patterns
-    const prologuePatterns = [
-      ['PHB', 'PHK', 'PLB'], // Bank switching prologue
-      ['REP', 'SEP'],        // Processor flag setup
-      ['PHA', 'PHX', 'PHY'], // Register preservation
-      ['PHP']               // Processor status preservation
-    ];
-
-    for (let i = 0; i < lines.length - 2; i++) {
-      const sequence = [
-        lines[i]?.instruction.mnemonic,
-        lines[i + 1]?.instruction.mnemonic,
-        lines[i + 2]?.instruction.mnemonic
-      ];
-
-      // Check for prologue patterns
-      for (const pattern of prologuePatterns) {
-        if (this.matchesPattern(sequence, pattern)) {
-          const addr = lines[i].address;
-
-          if (!functions.has(addr)) {
-            const func: FunctionInfo = {
-              startAddress: addr,
-              callers: new Set(),
-              callees: new Set(),
-              basicBlocks: new Set(),
-              isInterrupt: false,
-              confidence: 0.7 // Medium confidence for prologue patterns
-            };
-            functions.set(addr, func);
-          }
-        }
+    // One automaton pass over the line stream instead of comparing every
+    // pattern at every offset
+    SEQUENCE_AUTOMATON.scan(lines, (patternIndex, startIndex) => {
+      if (patternIndex >= POINTER_SKELETON_INDEX || startIndex >= lines.length - 2) {
+        return;
       }
-    }
-  }
-
-  private matchesPattern(sequence: (string | undefined)[], pattern: string[]): boolean {
-    if (sequence.length < pattern.length) return false;
 
-    for (let i = 0; i < pattern.length; i++) {
-      if (sequence[i] !== pattern[i]) return false;
-    }
-    return true;
+      const addr = lines[startIndex].address;
+      if (!functions.has(addr)) {
+        const func: FunctionInfo = {
+          startAddress: addr,
+          callers: new Set(),
+          callees: new Set(),
+          basicBlocks: new Set(),
+          isInterrupt: false,
+          confidence: 0.7 // Medium confidence for prologue patterns
+        };
+        functions.set(addr, func);
+      }
+    });
   }
 
   private detectDeadCodeBoundaries(lines: DisassemblyLine[], functions: Map<number, FunctionInfo>): void {
@@ -627,11 +1699,15 @@ export class AnalysisEngine {
 
       // Look for unconditional control flow followed by unreachable code
       if (['JMP', 'BRA', 'BRL', 'RTS', 'RTI', 'RTL'].includes(currentLine.instruction.mnemonic)) {
-        // Check if next instruction is not a known target
+        // Check if next instruction is not a known target; the shared
+        // index answers this from its branch-target bitset instead of a
+        // per-boundary scan over every line
         const nextAddr = nextLine.address;
-        const isTarget = lines.some(line =>
-          line.operand === nextAddr && this.isBranchOrJump(line.instruction.mnemonic)
-        );
+        const isTarget = this.addressIndex
+          ? this.addressIndex.isBranchTarget(nextAddr)
+          : lines.some(line =>
+            line.operand === nextAddr && this.isBranchOrJump(line.instruction.mnemonic)
+          );
 
         // If next instruction is not a target, it might start a new function
         if (!isTarget && !functions.has(nextAddr)) {
@@ -650,9 +1726,14 @@ export class AnalysisEngine {
   }
 
   private detectPointerTables(lines: DisassemblyLine[]): void {
-    // Look for sequences of LDA/STA with pointer-like operands
-    for (let i = 0; i < lines.length - 3; i++) {
-      const sequence = lines.slice(i, i + 4);
+    // Automaton pass finds the LDA/STA mnemonic skeleton; each hit is then
+    // verified against addressing modes and operand adjacency
+    SEQUENCE_AUTOMATON.scan(lines, (patternIndex, startIndex) => {
+      if (patternIndex !== POINTER_SKELETON_INDEX) {
+        return;
+      }
+
+      const sequence = lines.slice(startIndex, startIndex + 4);
 
       // Pattern: LDA table,X / STA pointer / LDA table+1,X / STA pointer+1
       if (this.isPointerTablePattern(sequence)) {
@@ -670,7 +1751,7 @@ export class AnalysisEngine {
           this.dataStructures.set(tableAddr, dataStruct);
         }
       }
-    }
+    });
   }
 
   private isPointerTablePattern(sequence: DisassemblyLine[]): boolean {
@@ -797,14 +1878,15 @@ export class AnalysisEngine {
 
   private estimateTableSize(lines: DisassemblyLine[], tableAddr: number, type: string): number {
     // Conservative estimate based on usage patterns
-    let usageCount = 0;
     let maxOffset = 0;
 
-    for (const line of lines) {
-      if (line.operand === tableAddr ||
-          (line.operand !== undefined && Math.abs(line.operand - tableAddr) < 256)) {
-        usageCount++;
-        if (line.operand !== undefined && line.operand > tableAddr) {
+    if (this.addressIndex) {
+      maxOffset = this.addressIndex.maxOperandOffset(tableAddr, 256);
+    } else {
+      for (const line of lines) {
+        if (line.operand !== undefined &&
+            line.operand > tableAddr &&
+            line.operand - tableAddr < 256) {
           maxOffset = Math.max(maxOffset, line.operand - tableAddr);
         }
       }
@@ -1225,6 +2307,11 @@ export class AnalysisEngine {
     return this.cfg;
   }
 
+  /** Compact integer-indexed CFG view, or null before the first analyze() */
+  public getCompactControlFlowGraph(): CompactControlFlowGraph | null {
+    return this.compactCfg;
+  }
+
   public getSymbols(): Map<number, SymbolInfo> {
     return this.symbols;
   }
@@ -12,6 +12,10 @@ import {
   AudioClassification,
   TextClassification
 } from './ai-pattern-recognition';
+import { Worker } from 'worker_threads';
+import * as os from 'os';
+import * as path from 'path';
+import type { AssetWorkItem, AssetWorkResult } from './parallel-asset-worker';
 
 export interface Tile {
   data: Uint8Array;
@@ -276,6 +280,19 @@ export interface DialogueTree {
 export type GraphicsFormat = '2bpp' | '4bpp' | '8bpp';
 export type TextEncoding = 'ascii' | 'shift-jis' | 'custom';
 
+/** Candidate run of text-like bytes found by TextExtractor.scanCandidateRegions() */
+export interface TextCandidateRegion {
+  encoding: TextEncoding;
+  address: number; // Offset into the scanned data
+  length: number;  // Run length in bytes
+}
+
+export interface TextScanOptions {
+  encodings?: TextEncoding[]; // Encodings to track (default: all)
+  minRunLengths?: Partial<Record<TextEncoding, number>>; // Minimum run per encoding (default: 3)
+  startAddress?: number; // Added to each region's address
+}
+
 // Additional types for enhanced sequence extraction
 export interface SequenceHeader {
   address: number;
@@ -296,6 +313,33 @@ export interface ChannelCommandResult {
   commandLength: number;
 }
 
+// Bitplane expansion tables for the table-driven tile decode path:
+// PLANE_EXPANSION[plane][byte * 8 + x] is bit (7-x) of byte, pre-shifted
+// left by the plane index, so a whole 8-pixel row of one plane is decoded
+// with eight lookups and ORs instead of per-pixel bit extraction.
+const PLANE_EXPANSION: Uint8Array[] = (() => {
+  const tables: Uint8Array[] = [];
+  for (let plane = 0; plane < 8; plane++) {
+    const table = new Uint8Array(256 * 8);
+    for (let value = 0; value < 256; value++) {
+      for (let x = 0; x < 8; x++) {
+        table[value * 8 + x] = ((value >> (7 - x)) & 1) << plane;
+      }
+    }
+    tables.push(table);
+  }
+  return tables;
+})();
+
+// Per-format byte offset of each bitplane within a tile row pair, matching
+// the plane offset math in the bit-by-bit decoder (including the 8bpp
+// layout where planes 6/7 reuse the plane 4/5 offsets)
+const PLANE_BASES: Record<GraphicsFormat, number[]> = {
+  '2bpp': [0, 8],
+  '4bpp': [0, 8, 16, 24],
+  '8bpp': [0, 8, 16, 24, 32, 40, 32, 40]
+};
+
 /**
  * Graphics Extraction Module
  * Extracts tiles, sprites, palettes, and backgrounds from SNES VRAM data
@@ -309,24 +353,32 @@ export class GraphicsExtractor {
     const tiles: Tile[] = [];
     const bytesPerTile = this.getBytesPerTile(format);
     const maxTiles = count || Math.floor(data.length / bytesPerTile);
+    const tileCount = Math.min(maxTiles, Math.ceil(data.length / bytesPerTile));
+
+    // Preallocated tile atlas: every tile decodes into its own 64-pixel
+    // slot, so a full CHR bank dump costs one allocation instead of one
+    // per tile
+    const atlas = new Uint8Array(tileCount * 64);
 
-    for (let i = 0; i < maxTiles && (i * bytesPerTile) < data.length; i++) {
+    for (let i = 0; i < tileCount; i++) {
       const offset = i * bytesPerTile;
-      const tileData = data.slice(offset, offset + bytesPerTile);
 
       // Get AI classification if available
       let aiClassification: GraphicsClassification | undefined;
       if (aiRecognizer) {
         try {
-          aiClassification = await aiRecognizer.classifyGraphicsData(tileData, format);
+          aiClassification = await aiRecognizer.classifyGraphicsData(
+            data.slice(offset, offset + bytesPerTile), format);
         } catch (error) {
           // Fall back to heuristic classification if AI fails
           console.warn('AI graphics classification failed, using heuristics:', error);
         }
       }
 
+      this.decodeTileInto(data, offset, offset + bytesPerTile, format, atlas, i * 64);
+
       tiles.push({
-        data: this.convertPlanarToLinear(tileData, format),
+        data: atlas.subarray(i * 64, (i + 1) * 64),
         width: 8,
         height: 8,
         bitsPerPixel: this.getBitsPerPixel(format),
@@ -508,35 +560,47 @@ export class GraphicsExtractor {
    * SNES stores graphics in planar format for hardware efficiency
    */
   private convertPlanarToLinear(planarData: Uint8Array, format: GraphicsFormat): Uint8Array {
-    const bpp = this.getBitsPerPixel(format);
     const pixels = new Uint8Array(64); // 8x8 = 64 pixels
+    this.decodeTileInto(planarData, 0, planarData.length, format, pixels, 0);
+    return pixels;
+  }
+
+  /**
+   * Table-driven planar-to-linear decode into a preallocated output.
+   *
+   * Decodes the 8x8 tile starting at tileOffset in data and writes the 64
+   * linear pixels at outOffset. Each tile row is assembled from one
+   * expansion-table lookup block per bitplane (eight ORs) instead of 64
+   * per-pixel bit extractions, which is what dominates full CHR bank dumps.
+   * Plane offsets past tileEnd are skipped, preserving the clamping the
+   * per-tile slice gave the bit-by-bit decoder.
+   */
+  private decodeTileInto(data: Uint8Array, tileOffset: number, tileEnd: number, format: GraphicsFormat, out: Uint8Array, outOffset: number): void {
+    const bases = PLANE_BASES[format];
+    const limit = Math.min(tileEnd, data.length);
 
     for (let y = 0; y < 8; y++) {
-      for (let x = 0; x < 8; x++) {
-        let pixelValue = 0;
-
-        // Extract bits from each plane
-        for (let plane = 0; plane < bpp; plane++) {
-          let planeOffset;
-          if (bpp === 2) {
-            planeOffset = y * 2 + (plane * 8);
-          } else if (bpp === 4) {
-            planeOffset = y * 2 + (plane < 2 ? 0 : 16) + ((plane % 2) * 8);
-          } else { // 8bpp
-            planeOffset = y * 2 + (plane < 2 ? 0 : plane < 4 ? 16 : 32) + ((plane % 2) * 8);
-          }
+      const row = outOffset + y * 8;
+      const rowBase = tileOffset + y * 2;
 
-          if (planeOffset < planarData.length) {
-            const bit = (planarData[planeOffset] >> (7 - x)) & 1;
-            pixelValue |= bit << plane;
-          }
+      for (let plane = 0; plane < bases.length; plane++) {
+        const planeOffset = rowBase + bases[plane];
+        if (planeOffset >= limit) {
+          continue;
         }
 
-        pixels[y * 8 + x] = pixelValue;
+        const table = PLANE_EXPANSION[plane];
+        const e = data[planeOffset] << 3;
+        out[row] |= table[e];
+        out[row + 1] |= table[e + 1];
+        out[row + 2] |= table[e + 2];
+        out[row + 3] |= table[e + 3];
+        out[row + 4] |= table[e + 4];
+        out[row + 5] |= table[e + 5];
+        out[row + 6] |= table[e + 6];
+        out[row + 7] |= table[e + 7];
       }
     }
-
-    return pixels;
   }
 }
 
@@ -2076,6 +2140,114 @@ export class AudioExtractor {
 export class TextExtractor {
   private customTables: Map<string, Map<number, string>> = new Map();
 
+  /** Encoding order fixing which validity bit belongs to which encoding */
+  private static readonly SCAN_ENCODINGS: TextEncoding[] = ['ascii', 'shift-jis', 'custom'];
+
+  /**
+   * Per-encoding 256-entry validity bitmaps folded into one table: bit i
+   * of VALIDITY[byte] is set when the byte can appear in text under
+   * SCAN_ENCODINGS[i]. One table lookup per scanned byte classifies it
+   * for every encoding at once.
+   */
+  private static readonly VALIDITY: Uint8Array = TextExtractor.buildValidityTable();
+
+  private static buildValidityTable(): Uint8Array {
+    const table = new Uint8Array(256);
+    const mark = (bit: number, isValid: (byte: number) => boolean): void => {
+      for (let byte = 0; byte < 256; byte++) {
+        if (isValid(byte)) table[byte] |= 1 << bit;
+      }
+    };
+
+    // ascii - mirrors extractASCIIStrings(): printable plus CR/LF
+    mark(0, b => (b >= 0x20 && b <= 0x7E) || b === 0x0A || b === 0x0D);
+
+    // shift-jis - single-byte approximation: ASCII, half-width katakana,
+    // and the double-byte lead/trail ranges (a run classifier cannot
+    // distinguish lead from trail position, so their union is used)
+    mark(1, b => (b >= 0x20 && b <= 0x7E) ||
+                 (b >= 0x40 && b <= 0x7E) ||
+                 (b >= 0x81 && b <= 0x9F) ||
+                 (b >= 0xA1 && b <= 0xDF) ||
+                 (b >= 0xE0 && b <= 0xFC));
+
+    // custom - mirrors extractCustomStrings(): common SNES text ranges
+    // plus terminator/space bytes
+    mark(2, b => (b >= 0x40 && b <= 0xDF) ||
+                 (b >= 0x20 && b <= 0x7E) ||
+                 b === 0x00 || b === 0xFF);
+
+    return table;
+  }
+
+  /**
+   * Single-pass candidate scan across all enabled encodings.
+   *
+   * Text sweeps previously walked the data once per encoding; this pass
+   * tracks a run per encoding simultaneously using the folded validity
+   * table. Each byte costs one lookup and one mask compare - per-run
+   * bookkeeping only happens when some encoding's validity transitions.
+   * Runs meeting their encoding's minimum length are emitted as candidate
+   * regions (in order of run end) for the decoders to materialize; the
+   * data is never re-scanned per encoding.
+   */
+  scanCandidateRegions(data: Uint8Array, options: TextScanOptions = {}): TextCandidateRegion[] {
+    const encodings = options.encodings ?? TextExtractor.SCAN_ENCODINGS;
+    const base = options.startAddress ?? 0;
+    const validity = TextExtractor.VALIDITY;
+
+    let enabledMask = 0;
+    const minRun = new Int32Array(TextExtractor.SCAN_ENCODINGS.length).fill(3);
+    for (const encoding of encodings) {
+      const bit = TextExtractor.SCAN_ENCODINGS.indexOf(encoding);
+      if (bit < 0) continue;
+      enabledMask |= 1 << bit;
+      minRun[bit] = options.minRunLengths?.[encoding] ?? 3;
+    }
+
+    const regions: TextCandidateRegion[] = [];
+    const runStart = new Int32Array(TextExtractor.SCAN_ENCODINGS.length).fill(-1);
+    let active = 0;
+
+    const closeRun = (bit: number, end: number): void => {
+      const length = end - runStart[bit];
+      if (length >= minRun[bit]) {
+        regions.push({
+          encoding: TextExtractor.SCAN_ENCODINGS[bit],
+          address: base + runStart[bit],
+          length
+        });
+      }
+      runStart[bit] = -1;
+    };
+
+    for (let i = 0; i < data.length; i++) {
+      const mask = validity[data[i]] & enabledMask;
+      if (mask === active) continue;
+
+      const started = mask & ~active;
+      const ended = active & ~mask;
+      for (let bit = 0; bit < TextExtractor.SCAN_ENCODINGS.length; bit++) {
+        const flag = 1 << bit;
+        if (ended & flag) {
+          closeRun(bit, i);
+        } else if (started & flag) {
+          runStart[bit] = i;
+        }
+      }
+      active = mask;
+    }
+
+    // Flush runs still open at the end of the data
+    for (let bit = 0; bit < TextExtractor.SCAN_ENCODINGS.length; bit++) {
+      if (runStart[bit] >= 0) {
+        closeRun(bit, data.length);
+      }
+    }
+
+    return regions;
+  }
+
   /**
    * Detect text encoding used in the ROM
    */
@@ -2158,29 +2330,23 @@ export class TextExtractor {
 
   private extractASCIIStrings(data: Uint8Array, startAddress: number, minLength: number): TextString[] {
     const strings: TextString[] = [];
-    let currentString = '';
-    let stringStart = 0;
-
-    for (let i = 0; i < data.length; i++) {
-      const byte = data[i];
 
-      if ((byte >= 0x20 && byte <= 0x7E) || byte === 0x0A || byte === 0x0D) {
-        if (currentString.length === 0) {
-          stringStart = i;
-        }
-        currentString += String.fromCharCode(byte);
-      } else {
-        if (currentString.length >= minLength) {
-          strings.push({
-            text: currentString.trim(),
-            encoding: 'ascii',
-            address: startAddress + stringStart,
-            length: currentString.length,
-            context: this.guessTextContext(currentString)
-          });
-        }
-        currentString = '';
+    const regions = this.scanCandidateRegions(data, {
+      encodings: ['ascii'],
+      minRunLengths: { ascii: minLength }
+    });
+    for (const region of regions) {
+      let currentString = '';
+      for (let i = 0; i < region.length; i++) {
+        currentString += String.fromCharCode(data[region.address + i]);
       }
+      strings.push({
+        text: currentString.trim(),
+        encoding: 'ascii',
+        address: startAddress + region.address,
+        length: currentString.length,
+        context: this.guessTextContext(currentString)
+      });
     }
 
     return strings;
@@ -2196,22 +2362,18 @@ export class TextExtractor {
   private extractCustomStrings(data: Uint8Array, startAddress: number, minLength: number): TextString[] {
     const strings: TextString[] = [];
 
-    // Common SNES text patterns - look for sequences that might be text
-    // Many SNES games use values 0x40-0xFF for text characters
-    let currentString = '';
-    let stringStart = 0;
-
-    for (let i = 0; i < data.length; i++) {
-      const byte = data[i];
-
-      // SNES games often use 0x40-0xDF for text, with control codes in other ranges
-      if ((byte >= 0x40 && byte <= 0xDF) ||
-          (byte >= 0x20 && byte <= 0x7E) ||  // ASCII range
-          byte === 0x00 || byte === 0xFF) {  // Common terminators/spaces
-
-        if (currentString.length === 0) {
-          stringStart = i;
-        }
+    // Common SNES text patterns: games often use 0x40-0xDF for text with
+    // control codes in other ranges. Hex placeholders expand one byte to
+    // several display characters, so the length filter applies to the
+    // decoded string, not the raw run - scan with minimum 1 and filter here.
+    const regions = this.scanCandidateRegions(data, {
+      encodings: ['custom'],
+      minRunLengths: { custom: 1 }
+    });
+    for (const region of regions) {
+      let currentString = '';
+      for (let i = 0; i < region.length; i++) {
+        const byte = data[region.address + i];
 
         // Convert to approximate ASCII for display
         if (byte >= 0x40 && byte <= 0x5F) {
@@ -2225,35 +2387,19 @@ export class TextExtractor {
         } else {
           currentString += '[' + byte.toString(16).toUpperCase().padStart(2, '0') + ']'; // Hex representation
         }
-      } else {
-        // End of potential string
-        if (currentString.length >= minLength) {
-          const cleanString = currentString.trim().replace(/\[[0-9A-F]{2}\]/gi, ' ').trim();
-          if (cleanString.length >= minLength) {
-            strings.push({
-              text: cleanString,
-              encoding: 'custom',
-              address: startAddress + stringStart,
-              length: currentString.length,
-              context: this.guessTextContext(cleanString)
-            });
-          }
-        }
-        currentString = '';
       }
-    }
 
-    // Handle string at end of data
-    if (currentString.length >= minLength) {
-      const cleanString = currentString.trim().replace(/\[[0-9A-F]{2}\]/gi, ' ').trim();
-      if (cleanString.length >= minLength) {
-        strings.push({
-          text: cleanString,
-          encoding: 'custom',
-          address: startAddress + stringStart,
-          length: currentString.length,
-          context: this.guessTextContext(cleanString)
-        });
+      if (currentString.length >= minLength) {
+        const cleanString = currentString.trim().replace(/\[[0-9A-F]{2}\]/gi, ' ').trim();
+        if (cleanString.length >= minLength) {
+          strings.push({
+            text: cleanString,
+            encoding: 'custom',
+            address: startAddress + region.address,
+            length: currentString.length,
+            context: this.guessTextContext(cleanString)
+          });
+        }
       }
     }
 
@@ -2289,6 +2435,10 @@ export class TextExtractor {
   }
 }
 
+export interface ParallelExtractionOptions {
+  workers?: number; // Worker thread count (default: available CPU count)
+}
+
 /**
  * Main Asset Extractor Class
  * Coordinates all asset extraction operations
@@ -2361,6 +2511,135 @@ export class AssetExtractor {
     return result;
   }
 
+  /**
+   * Parallel version of extractAssets(): fans graphics, text and audio work
+   * items out to a worker_threads pool with the ROM shared read-only.
+   *
+   * The graphics window is split into per-worker slices at tile boundaries
+   * and text scanning runs as one whole-ROM item (strings may span any
+   * region, so it cannot be chunked without cutting matches); audio BRR
+   * scanning gets its own item. Items are scheduled round-robin and results
+   * aggregated in item order, so output ordering matches the sequential
+   * path. Falls back to extractAssets() when AI recognition is enabled,
+   * since the AI models cannot be shared across workers.
+   */
+  async extractAssetsParallel(romData: Uint8Array, options: ParallelExtractionOptions = {}): Promise<{
+    graphics: { tiles: Tile[]; sprites: Sprite[]; palettes: Palette[]; backgrounds: Background[] };
+    audio: { spcProgram?: SPCProgram; samples: BRRSample[]; sequences: MusicSequence[] };
+    text: { strings: TextString[]; dialogues: DialogueTree[] };
+  }> {
+    if (this.aiPatternRecognizer) {
+      return this.extractAssets(romData);
+    }
+
+    const workerCount = Math.max(1, options.workers || os.cpus().length);
+
+    // Share the ROM read-only across all workers
+    const romBuffer = new SharedArrayBuffer(romData.length);
+    new Uint8Array(romBuffer).set(romData);
+
+    // Build work items: graphics window sliced per worker at tile
+    // boundaries, text and audio as single whole-region items
+    const items: AssetWorkItem[] = [];
+    let nextId = 0;
+
+    if (romData.length > 0x8000) {
+      const windowStart = 0x8000;
+      const windowEnd = Math.min(0x10000, romData.length);
+      const bytesPerTile = 32; // 4bpp
+      const totalTiles = Math.floor((windowEnd - windowStart) / bytesPerTile);
+      const tilesPerSlice = Math.max(1, Math.ceil(totalTiles / workerCount));
+
+      for (let tile = 0; tile < totalTiles; tile += tilesPerSlice) {
+        const start = windowStart + tile * bytesPerTile;
+        const end = Math.min(windowStart + (tile + tilesPerSlice) * bytesPerTile, windowEnd);
+        items.push({ id: nextId++, kind: 'graphics-tiles', start, end, baseAddress: start, format: '4bpp' });
+      }
+    }
+
+    const encoding = this.textExtractor.detectEncoding(romData);
+    items.push({ id: nextId++, kind: 'text-strings', start: 0, end: romData.length, baseAddress: 0, encoding, minLength: 3 });
+    items.push({ id: nextId++, kind: 'audio-samples', start: 0, end: romData.length, baseAddress: 0 });
+
+    // Round-robin the items across the pool
+    const partitions: AssetWorkItem[][] = Array.from({ length: Math.min(workerCount, items.length) }, () => []);
+    items.forEach((item, index) => partitions[index % partitions.length].push(item));
+
+    const workerResults = await Promise.all(
+      partitions.map(partition => this.runAssetWorker(romBuffer, romData.length, partition))
+    );
+
+    // Aggregate in item order so output matches the sequential path
+    const byId = new Map<number, AssetWorkResult>();
+    for (const results of workerResults) {
+      for (const result of results) {
+        byId.set(result.id, result);
+      }
+    }
+
+    const aggregated = {
+      graphics: {
+        tiles: [] as Tile[],
+        sprites: [] as Sprite[],
+        palettes: [] as Palette[],
+        backgrounds: [] as Background[]
+      },
+      audio: {
+        samples: [] as BRRSample[],
+        sequences: [] as MusicSequence[]
+      },
+      text: {
+        strings: [] as TextString[],
+        dialogues: [] as DialogueTree[]
+      }
+    };
+
+    for (let id = 0; id < nextId; id++) {
+      const result = byId.get(id);
+      if (!result) {
+        continue;
+      }
+      if (result.tiles) {
+        aggregated.graphics.tiles.push(...result.tiles);
+      }
+      if (result.strings) {
+        aggregated.text.strings.push(...result.strings);
+      }
+      if (result.samples) {
+        aggregated.audio.samples.push(...result.samples);
+      }
+    }
+
+    return aggregated;
+  }
+
+  /**
+   * Spawn a single asset-extraction worker for a set of work items
+   */
+  private runAssetWorker(romBuffer: SharedArrayBuffer, romLength: number, items: AssetWorkItem[]): Promise<AssetWorkResult[]> {
+    return new Promise((resolve, reject) => {
+      // Under tsx/ts-node __filename is still .ts; spawn the matching worker source
+      const runningFromSource = __filename.endsWith('.ts');
+      const workerFile = path.join(__dirname, `parallel-asset-worker.${runningFromSource ? 'ts' : 'js'}`);
+
+      const worker = new Worker(workerFile, {
+        workerData: { romBuffer, romLength, items },
+        execArgv: runningFromSource ? ['--require', 'tsx/cjs'] : undefined
+      });
+
+      worker.once('message', (results: AssetWorkResult[]) => {
+        resolve(results);
+        void worker.terminate();
+      });
+      worker.once('error', reject);
+      worker.once('exit', code => {
+        if (code !== 0) {
+          reject(new Error(`Asset worker exited with code ${code}`));
+        }
+      });
+    });
+  }
+
   getGraphicsExtractor(): GraphicsExtractor {
     return this.graphicsExtractor;
   }
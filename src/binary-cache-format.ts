@@ -0,0 +1,382 @@
+/**
+ * Binary Persistent Cache Format
+ *
+ * Compact on-disk encoding for ROMAnalysisCache entries. The dominant cached
+ * payload is DisassemblyLine[], which JSON both parses slowly and inflates
+ * 5-10x on disk (every mnemonic, addressing mode and hex digit repeated per
+ * line). This format stores:
+ *
+ * - a versioned header so stale cache files are rejected, not misread
+ * - a string table so mnemonics/addressing modes/labels/comments are written
+ *   once and referenced by index
+ * - length-prefixed per-line records with numeric fields packed as fixed-size
+ *   integers instead of decimal text
+ *
+ * Entry payloads that are not DisassemblyLine[] (validation results, audio
+ * state, ...) fall back to a JSON blob inside the same container, so every
+ * cache entry round-trips through one read/write path.
+ */
+
+import { DisassemblyLine, Instruction, CycleInfo, AddressingMode } from './types';
+import { CacheEntry } from './analysis-cache';
+
+const MAGIC = 'SNDC';
+// v2: string-table indices widened from uint16 to uint32 — a large ROM with
+// per-address labels and comments can intern more than 65,535 distinct
+// strings, and a wrapped index corrupts lines without failing validation
+const FORMAT_VERSION = 2;
+
+const enum PayloadKind {
+  Json = 0,
+  DisassemblyLines = 1
+}
+
+// Line record flag bits
+const FLAG_HAS_OPERAND = 0x01;
+const FLAG_HAS_LABEL = 0x02;
+const FLAG_HAS_COMMENT = 0x04;
+const FLAG_CYCLES_NUMBER = 0x08;
+
+// CycleInfo optional-field mask bits
+const CYCLE_M16 = 0x01;
+const CYCLE_X16 = 0x02;
+const CYCLE_PAGE_BOUNDARY = 0x04;
+const CYCLE_MEMORY_ACCESS = 0x08;
+
+/**
+ * Growable little-endian buffer writer
+ */
+class BufferWriter {
+  private buffer: Buffer;
+  private offset = 0;
+
+  constructor(initialSize: number = 64 * 1024) {
+    this.buffer = Buffer.allocUnsafe(initialSize);
+  }
+
+  private ensure(bytes: number): void {
+    if (this.offset + bytes > this.buffer.length) {
+      const grown = Buffer.allocUnsafe(Math.max(this.buffer.length * 2, this.offset + bytes));
+      this.buffer.copy(grown, 0, 0, this.offset);
+      this.buffer = grown;
+    }
+  }
+
+  writeUInt8(value: number): void {
+    this.ensure(1);
+    this.buffer.writeUInt8(value & 0xFF, this.offset);
+    this.offset += 1;
+  }
+
+  writeUInt16(value: number): void {
+    this.ensure(2);
+    this.buffer.writeUInt16LE(value & 0xFFFF, this.offset);
+    this.offset += 2;
+  }
+
+  writeUInt32(value: number): void {
+    this.ensure(4);
+    this.buffer.writeUInt32LE(value >>> 0, this.offset);
+    this.offset += 4;
+  }
+
+  writeInt32(value: number): void {
+    this.ensure(4);
+    this.buffer.writeInt32LE(value | 0, this.offset);
+    this.offset += 4;
+  }
+
+  writeFloat64(value: number): void {
+    this.ensure(8);
+    this.buffer.writeDoubleLE(value, this.offset);
+    this.offset += 8;
+  }
+
+  writeBytes(bytes: Buffer): void {
+    this.ensure(bytes.length);
+    bytes.copy(this.buffer, this.offset);
+    this.offset += bytes.length;
+  }
+
+  writeString(value: string): void {
+    const encoded = Buffer.from(value, 'utf8');
+    this.writeUInt32(encoded.length);
+    this.writeBytes(encoded);
+  }
+
+  toBuffer(): Buffer {
+    return this.buffer.subarray(0, this.offset);
+  }
+}
+
+/**
+ * Little-endian buffer reader with bounds checking via Buffer's own throws
+ */
+class BufferReader {
+  private offset = 0;
+
+  constructor(private buffer: Buffer) {}
+
+  readUInt8(): number {
+    const value = this.buffer.readUInt8(this.offset);
+    this.offset += 1;
+    return value;
+  }
+
+  readUInt16(): number {
+    const value = this.buffer.readUInt16LE(this.offset);
+    this.offset += 2;
+    return value;
+  }
+
+  readUInt32(): number {
+    const value = this.buffer.readUInt32LE(this.offset);
+    this.offset += 4;
+    return value;
+  }
+
+  readInt32(): number {
+    const value = this.buffer.readInt32LE(this.offset);
+    this.offset += 4;
+    return value;
+  }
+
+  readFloat64(): number {
+    const value = this.buffer.readDoubleLE(this.offset);
+    this.offset += 8;
+    return value;
+  }
+
+  readBytes(length: number): Buffer {
+    const slice = this.buffer.subarray(this.offset, this.offset + length);
+    this.offset += length;
+    return slice;
+  }
+
+  readString(): string {
+    const length = this.readUInt32();
+    return this.readBytes(length).toString('utf8');
+  }
+}
+
+/**
+ * Deduplicating string table builder: identical strings get one slot
+ */
+class StringTable {
+  private indices = new Map<string, number>();
+  private strings: string[] = [];
+
+  intern(value: string): number {
+    let index = this.indices.get(value);
+    if (index === undefined) {
+      index = this.strings.length;
+      this.indices.set(value, index);
+      this.strings.push(value);
+    }
+    return index;
+  }
+
+  write(writer: BufferWriter): void {
+    writer.writeUInt32(this.strings.length);
+    for (const value of this.strings) {
+      writer.writeString(value);
+    }
+  }
+
+  static read(reader: BufferReader): string[] {
+    const count = reader.readUInt32();
+    const strings: string[] = new Array(count);
+    for (let i = 0; i < count; i++) {
+      strings[i] = reader.readString();
+    }
+    return strings;
+  }
+}
+
+function isDisassemblyLineArray(data: unknown): data is DisassemblyLine[] {
+  return Array.isArray(data) &&
+    data.length > 0 &&
+    typeof data[0] === 'object' &&
+    data[0] !== null &&
+    typeof (data[0] as DisassemblyLine).address === 'number' &&
+    Array.isArray((data[0] as DisassemblyLine).bytes) &&
+    typeof (data[0] as DisassemblyLine).instruction === 'object';
+}
+
+function writeLines(writer: BufferWriter, lines: DisassemblyLine[]): void {
+  const strings = new StringTable();
+
+  // Intern up front so the table precedes the records
+  for (const line of lines) {
+    strings.intern(line.instruction.mnemonic);
+    strings.intern(line.instruction.addressingMode);
+    if (line.label !== undefined) strings.intern(line.label);
+    if (line.comment !== undefined) strings.intern(line.comment);
+  }
+  strings.write(writer);
+
+  writer.writeUInt32(lines.length);
+  for (const line of lines) {
+    const { instruction } = line;
+    const cyclesIsNumber = typeof instruction.cycles === 'number';
+
+    let flags = 0;
+    if (line.operand !== undefined) flags |= FLAG_HAS_OPERAND;
+    if (line.label !== undefined) flags |= FLAG_HAS_LABEL;
+    if (line.comment !== undefined) flags |= FLAG_HAS_COMMENT;
+    if (cyclesIsNumber) flags |= FLAG_CYCLES_NUMBER;
+
+    writer.writeUInt32(line.address);
+    writer.writeUInt8(flags);
+    if (line.operand !== undefined) {
+      writer.writeInt32(line.operand);
+    }
+
+    writer.writeUInt8(line.bytes.length);
+    writer.writeBytes(Buffer.from(line.bytes));
+
+    writer.writeUInt8(instruction.opcode);
+    writer.writeUInt32(strings.intern(instruction.mnemonic));
+    writer.writeUInt32(strings.intern(instruction.addressingMode));
+    writer.writeUInt8(instruction.bytes);
+
+    if (cyclesIsNumber) {
+      writer.writeUInt8(instruction.cycles as number);
+    } else {
+      const cycles = instruction.cycles as CycleInfo;
+      let mask = 0;
+      if (cycles.m16 !== undefined) mask |= CYCLE_M16;
+      if (cycles.x16 !== undefined) mask |= CYCLE_X16;
+      if (cycles.pageBoundary !== undefined) mask |= CYCLE_PAGE_BOUNDARY;
+      if (cycles.memoryAccess !== undefined) mask |= CYCLE_MEMORY_ACCESS;
+
+      writer.writeUInt8(cycles.base);
+      writer.writeUInt8(mask);
+      if (cycles.m16 !== undefined) writer.writeUInt8(cycles.m16);
+      if (cycles.x16 !== undefined) writer.writeUInt8(cycles.x16);
+      if (cycles.pageBoundary !== undefined) writer.writeUInt8(cycles.pageBoundary);
+      if (cycles.memoryAccess !== undefined) writer.writeUInt8(cycles.memoryAccess);
+    }
+
+    if (line.label !== undefined) {
+      writer.writeUInt32(strings.intern(line.label));
+    }
+    if (line.comment !== undefined) {
+      writer.writeUInt32(strings.intern(line.comment));
+    }
+  }
+}
+
+function readLines(reader: BufferReader): DisassemblyLine[] {
+  const strings = StringTable.read(reader);
+  const lineCount = reader.readUInt32();
+  const lines: DisassemblyLine[] = new Array(lineCount);
+
+  for (let i = 0; i < lineCount; i++) {
+    const address = reader.readUInt32();
+    const flags = reader.readUInt8();
+
+    let operand: number | undefined;
+    if (flags & FLAG_HAS_OPERAND) {
+      operand = reader.readInt32();
+    }
+
+    const byteCount = reader.readUInt8();
+    const bytes = Array.from(reader.readBytes(byteCount));
+
+    const opcode = reader.readUInt8();
+    const mnemonic = strings[reader.readUInt32()];
+    const addressingMode = strings[reader.readUInt32()] as AddressingMode;
+    const instrBytes = reader.readUInt8();
+
+    let cycles: number | CycleInfo;
+    if (flags & FLAG_CYCLES_NUMBER) {
+      cycles = reader.readUInt8();
+    } else {
+      const base = reader.readUInt8();
+      const mask = reader.readUInt8();
+      const info: CycleInfo = { base };
+      if (mask & CYCLE_M16) info.m16 = reader.readUInt8();
+      if (mask & CYCLE_X16) info.x16 = reader.readUInt8();
+      if (mask & CYCLE_PAGE_BOUNDARY) info.pageBoundary = reader.readUInt8();
+      if (mask & CYCLE_MEMORY_ACCESS) info.memoryAccess = reader.readUInt8();
+      cycles = info;
+    }
+
+    const instruction: Instruction = { opcode, mnemonic, addressingMode, bytes: instrBytes, cycles };
+    const line: DisassemblyLine = { address, bytes, instruction };
+    if (operand !== undefined) line.operand = operand;
+    if (flags & FLAG_HAS_LABEL) line.label = strings[reader.readUInt32()];
+    if (flags & FLAG_HAS_COMMENT) line.comment = strings[reader.readUInt32()];
+
+    lines[i] = line;
+  }
+
+  return lines;
+}
+
+/**
+ * Encode a cache entry into the binary container format
+ */
+export function encodeCacheEntry(entry: CacheEntry): Buffer {
+  const writer = new BufferWriter();
+
+  writer.writeBytes(Buffer.from(MAGIC, 'ascii'));
+  writer.writeUInt16(FORMAT_VERSION);
+
+  // Entry metadata is tiny; JSON keeps it forward-extensible
+  writer.writeString(JSON.stringify({
+    hash: entry.hash,
+    timestamp: entry.timestamp,
+    metadata: entry.metadata
+  }));
+
+  if (isDisassemblyLineArray(entry.data)) {
+    writer.writeUInt8(PayloadKind.DisassemblyLines);
+    writeLines(writer, entry.data);
+  } else {
+    writer.writeUInt8(PayloadKind.Json);
+    writer.writeString(JSON.stringify(entry.data));
+  }
+
+  return writer.toBuffer();
+}
+
+/**
+ * Decode a binary cache container back into a cache entry.
+ * Returns null for unrecognized magic or format versions.
+ */
+export function decodeCacheEntry(buffer: Buffer): CacheEntry | null {
+  if (buffer.length < 6 || buffer.toString('ascii', 0, 4) !== MAGIC) {
+    return null;
+  }
+
+  const reader = new BufferReader(buffer);
+  reader.readBytes(4); // magic
+  const version = reader.readUInt16();
+  if (version !== FORMAT_VERSION) {
+    return null;
+  }
+
+  const meta = JSON.parse(reader.readString()) as Pick<CacheEntry, 'hash' | 'timestamp' | 'metadata'>;
+  const payloadKind = reader.readUInt8();
+
+  let data: unknown;
+  switch (payloadKind) {
+  case PayloadKind.DisassemblyLines:
+    data = readLines(reader);
+    break;
+  case PayloadKind.Json:
+    data = JSON.parse(reader.readString());
+    break;
+  default:
+    return null;
+  }
+
+  return {
+    hash: meta.hash,
+    timestamp: meta.timestamp,
+    metadata: meta.metadata,
+    data
+  };
+}
@@ -227,6 +227,194 @@ export function decodeBRRFile(
   };
 }
 
+// Signed 4-bit expansion table: nibble 0-15 -> -8..+7
+const SIGNED_NIBBLE = new Int8Array(16);
+for (let i = 0; i < 16; i++) {
+  SIGNED_NIBBLE[i] = i < 8 ? i : i - 16;
+}
+
+export interface BatchedBRRResult {
+  samples: Int16Array;
+  sampleRate: number;
+  loopStart?: number;
+  blockCount: number;
+}
+
+/**
+ * Batched BRR decode kernel.
+ *
+ * Produces the same PCM stream as decodeBRRFile() but writes directly into
+ * one preallocated Int16Array: the filter state is carried in two scalars,
+ * nibble sign-expansion goes through a lookup table, and the filter
+ * multiplies use integer shifts instead of Math.floor divisions. No
+ * per-block or per-sample objects are allocated, which is what matters when
+ * AudioExtractor bulk-decodes thousands of samples from one ROM. Block info
+ * and statistics are not collected - use decodeBRRFile() when those are
+ * needed.
+ */
+export function decodeBRRFileBatched(
+  data: Uint8Array,
+  options: BRRDecoderOptions = {}
+): BatchedBRRResult {
+  const {
+    maxSamples = Infinity,
+    outputSampleRate = 32000
+  } = options;
+
+  const maxBlocks = Math.floor(data.length / 9);
+  const out = new Int16Array(maxBlocks * 16);
+
+  let prev1 = 0;
+  let prev2 = 0;
+  let outPos = 0;
+  let loopStart: number | undefined;
+  let blockCount = 0;
+  let position = 0;
+
+  while (position + 9 <= data.length && outPos < maxSamples) {
+    const header = data[position];
+    const range = header >>> 4;
+    const filter = (header >>> 2) & 3;
+    blockCount++;
+
+    if ((header & 2) !== 0) {
+      loopStart = outPos;
+    }
+
+    for (let b = 1; b <= 8; b++) {
+      const byte = data[position + b];
+
+      // High nibble first, then low nibble
+      for (let n = 0; n < 2; n++) {
+        let sample = SIGNED_NIBBLE[n === 0 ? byte >>> 4 : byte & 0x0F] << range;
+
+        switch (filter) {
+        case 1:
+          sample += (prev1 * 15) >> 4;
+          break;
+        case 2:
+          sample += ((prev1 * 61) >> 5) - ((prev2 * 15) >> 4);
+          break;
+        case 3:
+          sample += ((prev1 * 115) >> 6) - ((prev2 * 13) >> 4);
+          break;
+        }
+
+        // Clamp to 16-bit range
+        if (sample > 32767) sample = 32767;
+        else if (sample < -32768) sample = -32768;
+
+        out[outPos++] = sample;
+        prev2 = prev1;
+        prev1 = sample;
+      }
+    }
+
+    position += 9;
+
+    // End flag terminates the sample
+    if ((header & 1) !== 0) {
+      break;
+    }
+  }
+
+  return {
+    samples: out.subarray(0, outPos),
+    sampleRate: outputSampleRate,
+    loopStart,
+    blockCount
+  };
+}
+
+/**
+ * Streaming WAV writer: emits the header up front (total sample count must
+ * be known, which batched BRR decode provides) and PCM data in bounded
+ * chunks through a sink callback, so the full WAV file is never assembled
+ * in memory. The chunk passed to the sink is reused between calls - consume
+ * or copy it before returning.
+ */
+export class StreamingWAVWriter {
+  private chunk: Uint8Array;
+  private view: DataView;
+  private samplesWritten = 0;
+
+  constructor(
+    private sink: (chunk: Uint8Array) => void,
+    private totalSamples: number,
+    sampleRate: number = 32000,
+    chunkSize: number = 64 * 1024
+  ) {
+    const numChannels = 1; // Mono
+    const bitsPerSample = 16;
+    const blockAlign = numChannels * (bitsPerSample / 8);
+    const dataSize = totalSamples * blockAlign;
+
+    const header = new Uint8Array(44);
+    const view = new DataView(header.buffer);
+    const encoder = new TextEncoder();
+
+    header.set(encoder.encode('RIFF'), 0);
+    view.setUint32(4, 44 + dataSize - 8, true);
+    header.set(encoder.encode('WAVE'), 8);
+
+    header.set(encoder.encode('fmt '), 12);
+    view.setUint32(16, 16, true);  // chunk size
+    view.setUint16(20, 1, true);   // audio format (PCM)
+    view.setUint16(22, numChannels, true);
+    view.setUint32(24, sampleRate, true);
+    view.setUint32(28, sampleRate * blockAlign, true); // byte rate
+    view.setUint16(32, blockAlign, true);
+    view.setUint16(34, bitsPerSample, true);
+
+    header.set(encoder.encode('data'), 36);
+    view.setUint32(40, dataSize, true);
+
+    sink(header);
+
+    this.chunk = new Uint8Array(chunkSize);
+    this.view = new DataView(this.chunk.buffer);
+  }
+
+  writeSamples(samples: Int16Array, count: number = samples.length): void {
+    if (this.samplesWritten + count > this.totalSamples) {
+      throw new Error('StreamingWAVWriter: more samples written than declared in the header');
+    }
+
+    const samplesPerChunk = this.chunk.length >> 1;
+    let i = 0;
+    while (i < count) {
+      const n = Math.min(count - i, samplesPerChunk);
+      for (let j = 0; j < n; j++) {
+        this.view.setInt16(j * 2, samples[i + j], true);
+      }
+      this.sink(this.chunk.subarray(0, n * 2));
+      i += n;
+    }
+
+    this.samplesWritten += count;
+  }
+
+  getSamplesWritten(): number {
+    return this.samplesWritten;
+  }
+}
+
+/**
+ * Decode a BRR file straight to WAV chunks: batched decode into one PCM
+ * buffer, then stream it through StreamingWAVWriter. Returns the number of
+ * samples written.
+ */
+export function decodeBRRToWAVStream(
+  data: Uint8Array,
+  sink: (chunk: Uint8Array) => void,
+  options: BRRDecoderOptions = {}
+): number {
+  const decoded = decodeBRRFileBatched(data, options);
+  const writer = new StreamingWAVWriter(sink, decoded.samples.length, decoded.sampleRate);
+  writer.writeSamples(decoded.samples);
+  return writer.getSamplesWritten();
+}
+
 /**
  * Export BRR decoded samples to WAV format buffer.
  */
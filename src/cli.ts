@@ -12,6 +12,7 @@ import { intro, outro, select, text, confirm, multiselect, spinner, note, isCanc
 import { Listr } from 'listr2';
 import chalk from 'chalk';
 import { sessionManager } from './cli/session-manager';
+import { DisassemblyDaemon, sendDaemonRequest, defaultSocketPath } from './cli/daemon';
 import { showContextualHelp, getHelpForContext } from './cli/help-system';
 import { preferencesManager } from './cli/preferences-manager';
 import * as fs from 'fs';
@@ -696,6 +697,41 @@ async function main() {
       }
     });
 
+  program
+    .command('daemon-status')
+    .description('Show status of the running daemon')
+    .option('--socket <path>', 'Daemon socket path', defaultSocketPath())
+    .action(async (options: { socket: string }) => {
+      try {
+        const response = await sendDaemonRequest({ command: 'status' }, options.socket);
+        if (response.ok && response.status) {
+          console.log(`Daemon pid: ${response.status.pid}`);
+          console.log(`Uptime: ${(response.status.uptimeMs / 1000).toFixed(1)}s`);
+          console.log(`Jobs completed: ${response.status.jobsCompleted}`);
+          console.log(`Jobs failed: ${response.status.jobsFailed}`);
+        } else {
+          console.error('Error:', response.error || 'Unknown daemon error');
+        }
+      } catch (error) {
+        console.error('Error:', error instanceof Error ? error.message : error);
+        process.exit(1);
+      }
+    });
+
+  program
+    .command('daemon-stop')
+    .description('Shut down the running daemon')
+    .option('--socket <path>', 'Daemon socket path', defaultSocketPath())
+    .action(async (options: { socket: string }) => {
+      try {
+        await sendDaemonRequest({ command: 'shutdown' }, options.socket);
+        console.log('Daemon stopped.');
+      } catch (error) {
+        console.error('Error:', error instanceof Error ? error.message : error);
+        process.exit(1);
+      }
+    });
+
   program
     .command('preferences')
     .alias('prefs')
@@ -751,16 +787,27 @@ async function main() {
     .option('--brr-info', 'Show detailed BRR file information without decoding')
     .option('--brr-to-spc <input-dir> <output-spc>', 'Convert BRR files from input directory to a single SPC file')
     .option('-i, --interactive', 'Run in interactive mode')
-    .action(async (romFile: string | undefined, options: CLIOptions) => {
+    .option('--daemon', 'Run as a long-lived daemon accepting jobs over a local socket')
+    .option('--remote', 'Send this job to a running daemon instead of processing locally')
+    .option('--socket <path>', 'Socket path for --daemon and --remote', defaultSocketPath())
+    .action(async (romFile: string | undefined, options: CLIOptions & { daemon?: boolean; remote?: boolean; socket?: string }) => {
+      // Daemon mode: warm up once, then serve jobs until shut down.
+      // Skips the normal session load since start() handles it.
+      if (options.daemon) {
+        const daemon = new DisassemblyDaemon(options.socket);
+        await daemon.start();
+        return;
+      }
+
       // Load session data first
       await sessionManager.load();
-      
+
       // Only run interactive mode if explicitly requested
       if (options.interactive) {
         await runInteractiveMode();
         return;
       }
-      
+
       // If no ROM file is provided and not in interactive mode, show error and usage
       if (!romFile) {
         console.error('Error: ROM file is required when not running in interactive mode.');
@@ -775,6 +822,21 @@ async function main() {
       }
       
       try {
+        // Thin client path: hand the job to the warm daemon and relay its result
+        if (options.remote) {
+          const { daemon, remote, socket, ...jobOptions } = options;
+          const response = await sendDaemonRequest(
+            { command: 'disassemble', romFile, options: jobOptions },
+            socket
+          );
+          if (!response.ok) {
+            console.error('Error:', response.error || 'Unknown daemon error');
+            process.exit(1);
+          }
+          console.log(`Completed by daemon in ${response.durationMs}ms`);
+          return;
+        }
+
         const effectiveOutputDir = sessionManager.getEffectiveOutputDir(options.outputDir);
         const updatedOptions: CLIOptions = { ...options, outputDir: effectiveOutputDir };
         await disassembleROM(romFile, updatedOptions);
@@ -0,0 +1,242 @@
+/**
+ * CLI Daemon Mode
+ *
+ * Keeps one long-lived process warm so batch scripts that invoke the CLI
+ * thousands of times skip the cold-start cost on every job: loading the
+ * reference tables, constructing the validation engine, and re-reading
+ * session state. The daemon accepts jobs over a local socket as
+ * newline-delimited JSON and runs them through the same disassembleROM()
+ * path as a direct invocation, with globalROMCache staying warm between
+ * jobs. The client side is a thin connect/send/await wrapper.
+ */
+
+import * as net from 'net';
+import * as os from 'os';
+import * as path from 'path';
+import * as fs from 'fs';
+import { disassembleROM, CLIOptions } from '../disassembly-handler';
+import { sessionManager } from './session-manager';
+
+export interface DaemonRequest {
+  id: number;
+  command: 'disassemble' | 'ping' | 'status' | 'shutdown';
+  romFile?: string;
+  options?: CLIOptions;
+}
+
+export interface DaemonResponse {
+  id: number;
+  ok: boolean;
+  error?: string;
+  durationMs?: number;
+  status?: DaemonStatus;
+}
+
+export interface DaemonStatus {
+  pid: number;
+  uptimeMs: number;
+  jobsCompleted: number;
+  jobsFailed: number;
+}
+
+/** Default socket location: named pipe on Windows, unix socket elsewhere */
+export function defaultSocketPath(): string {
+  if (process.platform === 'win32') {
+    return '\\\\.\\pipe\\snes-disasm-daemon';
+  }
+  return path.join(os.tmpdir(), 'snes-disasm-daemon.sock');
+}
+
+export class DisassemblyDaemon {
+  private server: net.Server | null = null;
+  private readonly startedAt = Date.now();
+  private jobsCompleted = 0;
+  private jobsFailed = 0;
+
+  /**
+   * Jobs are serialized through this chain so two clients cannot
+   * interleave work against the shared decoder and cache state.
+   */
+  private jobQueue: Promise<void> = Promise.resolve();
+
+  constructor(private socketPath: string = defaultSocketPath()) {}
+
+  /**
+   * Warm up and start listening. Resolves once the socket is accepting
+   * connections; the process then stays alive until a shutdown request.
+   */
+  async start(): Promise<void> {
+    // Pay the heavy module and session costs once, before the first job:
+    // the reference tables load as an import side effect and the
+    // validation engine builds its lookup maps in its constructor.
+    await sessionManager.load();
+    const { SNESValidationEngine } = await import('../validation-engine');
+    new SNESValidationEngine('minimal');
+
+    // A stale socket file from a crashed daemon would block listen()
+    if (process.platform !== 'win32' && fs.existsSync(this.socketPath)) {
+      fs.unlinkSync(this.socketPath);
+    }
+
+    this.server = net.createServer((connection) => this.handleConnection(connection));
+
+    await new Promise<void>((resolve, reject) => {
+      this.server!.once('error', reject);
+      this.server!.listen(this.socketPath, () => {
+        this.server!.removeListener('error', reject);
+        resolve();
+      });
+    });
+
+    console.log(`snes-disasm daemon listening on ${this.socketPath} (pid ${process.pid})`);
+  }
+
+  stop(): void {
+    if (this.server) {
+      this.server.close();
+      this.server = null;
+    }
+    if (process.platform !== 'win32' && fs.existsSync(this.socketPath)) {
+      fs.unlinkSync(this.socketPath);
+    }
+  }
+
+  private handleConnection(connection: net.Socket): void {
+    let buffered = '';
+
+    connection.on('data', (chunk) => {
+      buffered += chunk.toString('utf8');
+
+      let newline = buffered.indexOf('\n');
+      while (newline >= 0) {
+        const line = buffered.slice(0, newline).trim();
+        buffered = buffered.slice(newline + 1);
+        newline = buffered.indexOf('\n');
+
+        if (line.length === 0) {
+          continue;
+        }
+
+        let request: DaemonRequest;
+        try {
+          request = JSON.parse(line);
+        } catch (error) {
+          this.send(connection, { id: -1, ok: false, error: 'Malformed request: not valid JSON' });
+          continue;
+        }
+
+        this.dispatch(connection, request);
+      }
+    });
+
+    connection.on('error', () => {
+      // Client went away mid-job; the job itself keeps running
+    });
+  }
+
+  private dispatch(connection: net.Socket, request: DaemonRequest): void {
+    switch (request.command) {
+    case 'ping':
+      this.send(connection, { id: request.id, ok: true });
+      break;
+
+    case 'status':
+      this.send(connection, {
+        id: request.id,
+        ok: true,
+        status: {
+          pid: process.pid,
+          uptimeMs: Date.now() - this.startedAt,
+          jobsCompleted: this.jobsCompleted,
+          jobsFailed: this.jobsFailed
+        }
+      });
+      break;
+
+    case 'shutdown':
+      this.send(connection, { id: request.id, ok: true });
+      connection.end();
+      this.stop();
+      break;
+
+    case 'disassemble':
+      this.jobQueue = this.jobQueue.then(() => this.runJob(connection, request));
+      break;
+
+    default:
+      this.send(connection, { id: request.id, ok: false, error: `Unknown command: ${request.command}` });
+    }
+  }
+
+  private async runJob(connection: net.Socket, request: DaemonRequest): Promise<void> {
+    if (!request.romFile && !request.options?.decodeBrr) {
+      this.send(connection, { id: request.id, ok: false, error: 'Job is missing a ROM file' });
+      return;
+    }
+
+    const started = Date.now();
+    try {
+      const options = request.options || {};
+      const effectiveOutputDir = sessionManager.getEffectiveOutputDir(options.outputDir);
+      await disassembleROM(request.romFile || '', { ...options, outputDir: effectiveOutputDir });
+      this.jobsCompleted++;
+      this.send(connection, { id: request.id, ok: true, durationMs: Date.now() - started });
+    } catch (error) {
+      this.jobsFailed++;
+      this.send(connection, {
+        id: request.id,
+        ok: false,
+        error: error instanceof Error ? error.message : String(error),
+        durationMs: Date.now() - started
+      });
+    }
+  }
+
+  private send(connection: net.Socket, response: DaemonResponse): void {
+    if (!connection.destroyed) {
+      connection.write(JSON.stringify(response) + '\n');
+    }
+  }
+}
+
+let nextRequestId = 1;
+
+/**
+ * Thin client: send one request to a running daemon and await its reply.
+ * Rejects with a clear message when no daemon is listening.
+ */
+export function sendDaemonRequest(
+  request: Omit<DaemonRequest, 'id'>,
+  socketPath: string = defaultSocketPath()
+): Promise<DaemonResponse> {
+  return new Promise((resolve, reject) => {
+    const id = nextRequestId++;
+    const connection = net.connect(socketPath);
+    let buffered = '';
+
+    connection.on('connect', () => {
+      connection.write(JSON.stringify({ ...request, id }) + '\n');
+    });
+
+    connection.on('data', (chunk) => {
+      buffered += chunk.toString('utf8');
+      const newline = buffered.indexOf('\n');
+      if (newline >= 0) {
+        connection.end();
+        try {
+          resolve(JSON.parse(buffered.slice(0, newline)));
+        } catch (error) {
+          reject(new Error('Malformed response from daemon'));
+        }
+      }
+    });
+
+    connection.on('error', (error: NodeJS.ErrnoException) => {
+      if (error.code === 'ENOENT' || error.code === 'ECONNREFUSED') {
+        reject(new Error(`No daemon running at ${socketPath} (start one with: snes-disasm --daemon)`));
+      } else {
+        reject(error);
+      }
+    });
+  });
+}
@@ -1,10 +1,32 @@
 import { Instruction, AddressingMode, DisassemblyLine, ProcessorFlags } from './types';
-import { INSTRUCTION_SET } from './instructions';
+import { OPCODE_TABLE } from './instructions';
 import { createDefaultFlags, applyREP, applySEP } from './processor-flags';
+import { instrumentation } from './utils/instrumentation';
+
+// Instrumentation ids interned once; decode() runs per instruction, so the
+// per-call cost must stay at a guarded increment plus a sampled timer
+const DECODE_TIMER = instrumentation.timer('decoder.decode');
+const DECODED_COUNTER = instrumentation.counter('decoder.instructions');
+const UNKNOWN_OPCODE_COUNTER = instrumentation.counter('decoder.unknownOpcodes');
+const MEMO_HIT_COUNTER = instrumentation.counter('decoder.memoHits');
 
 export class InstructionDecoder {
   private flags: ProcessorFlags = createDefaultFlags();
 
+  /**
+   * Decode memo, keyed on ROM offset with one lane per (M, X) state.
+   *
+   * Only the M and X flags change what a given offset decodes to (immediate
+   * operand width), so four lanes cover every possible outcome for a byte.
+   * Interactive sessions re-traverse the same hot banks dozens of times -
+   * after a label edit, or from a different entry point - and a memo hit
+   * replaces the full decode with an array read plus a shallow copy. The
+   * memo is bound to one data buffer by identity and resets itself when
+   * decode() is handed a different one.
+   */
+  private memoLanes: Array<Array<DisassemblyLine | undefined>> | null = null;
+  private memoData: Buffer | null = null;
+
   // Legacy compatibility
   private get mFlag(): boolean {
     return this.flags.m;
@@ -26,17 +48,64 @@ export class InstructionDecoder {
     this.flags = { ...flags };
   }
 
+  /** Enable or disable the (offset, M, X) decode memo */
+  setMemoEnabled(enabled: boolean): void {
+    if (enabled) {
+      if (!this.memoLanes) {
+        this.memoLanes = [[], [], [], []];
+      }
+    } else {
+      this.memoLanes = null;
+      this.memoData = null;
+    }
+  }
+
+  /** Drop all memoized lines, e.g. after patching the underlying data */
+  clearMemo(): void {
+    if (this.memoLanes) {
+      this.memoLanes = [[], [], [], []];
+    }
+    this.memoData = null;
+  }
+
   decode(data: Buffer, offset: number, address: number): DisassemblyLine | null {
     if (offset >= data.length) {
       return null;
     }
 
+    let memoLane: Array<DisassemblyLine | undefined> | null = null;
+    if (this.memoLanes) {
+      if (this.memoData !== data) {
+        this.clearMemo();
+        this.memoData = data;
+      }
+      memoLane = this.memoLanes![(this.flags.m ? 2 : 0) | (this.flags.x ? 1 : 0)];
+      const memoized = memoLane[offset];
+      if (memoized && memoized.address === address) {
+        instrumentation.increment(MEMO_HIT_COUNTER);
+        this.applyFlagEffects(memoized);
+        // Fresh per-call object: callers attach labels/comments to lines,
+        // which must not leak into the memo or later traversals
+        return {
+          address: memoized.address,
+          bytes: memoized.bytes,
+          instruction: memoized.instruction,
+          operand: memoized.operand
+        };
+      }
+    }
+
+    const timerStart = instrumentation.timeStart(DECODE_TIMER);
+    instrumentation.increment(DECODED_COUNTER);
+
     const opcode = data[offset];
-    const instruction = INSTRUCTION_SET.get(opcode);
+    const instruction = OPCODE_TABLE[opcode];
 
     if (!instruction) {
       // Unknown instruction - treat as data byte
-      return {
+      instrumentation.increment(UNKNOWN_OPCODE_COUNTER);
+      instrumentation.timeEnd(DECODE_TIMER, timerStart);
+      const dataLine: DisassemblyLine = {
         address,
         bytes: [opcode],
         instruction: {
@@ -48,6 +117,10 @@ export class InstructionDecoder {
         },
         operand: opcode
       };
+      if (memoLane) {
+        memoLane[offset] = dataLine;
+      }
+      return dataLine;
     }
 
     // Adjust instruction byte count based on processor flags
@@ -107,22 +180,39 @@ export class InstructionDecoder {
       operand = (address + actualBytes + operand!) & 0xFFFFFF;
     }
 
-    // Update processor flags for REP/SEP instructions
-    if (instruction.mnemonic === 'REP' && operand !== undefined) {
-      this.flags = applyREP(this.flags, operand);
-    } else if (instruction.mnemonic === 'SEP' && operand !== undefined) {
-      this.flags = applySEP(this.flags, operand);
-    }
+    instrumentation.timeEnd(DECODE_TIMER, timerStart);
 
-    return {
+    // Reuse the shared frozen record when the length is unchanged; only
+    // flag-dependent immediates need a per-line copy with the adjusted size.
+    const line: DisassemblyLine = {
       address,
       bytes,
-      instruction: {
-        ...instruction,
-        bytes: actualBytes
-      },
+      instruction: actualBytes === instruction.bytes
+        ? instruction
+        : { ...instruction, bytes: actualBytes },
       operand
     };
+
+    // Lane selection happened against the entry flags, so REP/SEP effects
+    // are applied after the memo store and replayed on every memo hit
+    if (memoLane) {
+      memoLane[offset] = line;
+    }
+    this.applyFlagEffects(line);
+
+    return line;
+  }
+
+  /** Update processor flags for REP/SEP instructions */
+  private applyFlagEffects(line: DisassemblyLine): void {
+    if (line.operand === undefined) {
+      return;
+    }
+    if (line.instruction.mnemonic === 'REP') {
+      this.flags = applyREP(this.flags, line.operand);
+    } else if (line.instruction.mnemonic === 'SEP') {
+      this.flags = applySEP(this.flags, line.operand);
+    }
   }
 
   formatOperand(line: DisassemblyLine): string {
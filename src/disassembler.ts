@@ -2,8 +2,9 @@ import { DisassemblyLine, DisassemblerOptions } from './types';
 import { InstructionDecoder } from './decoder';
 import { RomHeaderParser } from './rom-header-parser';
 import { RomParser, SNESRom } from './rom-parser';
-import { AnalysisEngine } from './analysis-engine';
+import { AnalysisEngine, AddressRange } from './analysis-engine';
 import { ExtendedOutputFormatterFactory, OutputOptions, SymbolTableEntry, CrossReference } from './output-formats-extended';
+import { MultiFormatExporter, ExportTarget } from './output-formatters';
 import { SymbolManager } from './symbol-manager';
 import {
   SNESValidationEngine,
@@ -18,12 +19,20 @@ import {
   generateRegisterComment,
   getRegisterInfo
 } from './snes-reference-tables';
-import { SPCExporter, SPC700State, DSPState } from './spc-exporter';
+import { SPCExporter, SPCBatchExporter, SPCSnapshot, SPC700State, DSPState } from './spc-exporter';
 import { SPCStateExtractor } from './spc-state-extractor';
 import { ROMAnalysisCache, globalROMCache } from './analysis-cache';
 import { createLogger, Logger, measurePerformance } from './utils/logger';
+import { BankHandler } from './bank-handler';
+import { Worker } from 'worker_threads';
+import * as os from 'os';
+import * as path from 'path';
 import * as fs from 'fs';
 
+export interface ParallelDisassemblyOptions {
+  workers?: number; // Worker thread count (default: available CPU count)
+}
+
 export class SNESDisassembler {
   private decoder: InstructionDecoder;
   private rom: SNESRom;
@@ -37,6 +46,7 @@ export class SNESDisassembler {
   private logger: Logger;
   private cache: ROMAnalysisCache;
   private lastAnalysisHash: string = '';
+  private dirtyRanges: AddressRange[] = [];
   protected isAnalyzing: boolean = false;
 
   constructor(romPath: string, options: DisassemblerOptions = {}) {
@@ -50,6 +60,9 @@ export class SNESDisassembler {
     // Log detected mapping mode
     this.logger.info(`Detected Mapping Mode: ${mappingMode}`);
     this.decoder = new InstructionDecoder();
+    // Interactive edits re-disassemble the same banks repeatedly with
+    // unchanged ROM bytes; the (offset, M, X) memo makes those nearly free
+    this.decoder.setMemoEnabled(true);
     this.labels = options.labels || new Map();
     this.comments = options.comments || new Map();
     this.analysisEngine = new AnalysisEngine();
@@ -135,6 +148,173 @@ this.validationEngine = new SNESValidationEngine(options.validationLogLevel || '
     return lines;
   }
 
+  /**
+   * Streaming variant of disassemble() that yields lines one at a time
+   * instead of materializing the full DisassemblyLine[] up front.
+   *
+   * Intended for full-ROM passes where the complete array would peak at
+   * hundreds of MB: consumers (output formatters, pipeline workers) can
+   * process and discard each line, keeping memory flat regardless of ROM
+   * size. Because lines are never collected, this path skips the
+   * disassembly cache and the whole-run validation pass; use disassemble()
+   * when those are needed.
+   */
+  *disassembleStream(startAddress?: number, endAddress?: number): Generator<DisassemblyLine, void, undefined> {
+    let currentAddress = startAddress || this.rom.header.nativeVectors.reset;
+    const finalAddress = endAddress || (currentAddress + 0x1000); // Default 4KB
+
+    let romOffset: number;
+    try {
+      romOffset = RomParser.getRomOffset(currentAddress, this.rom.cartridgeInfo);
+    } catch (error) {
+      throw new Error(`Invalid start address: $${currentAddress.toString(16).toUpperCase()}`);
+    }
+
+    while (currentAddress < finalAddress && romOffset < this.rom.data.length) {
+      const line = this.decoder.decode(this.rom.data, romOffset, currentAddress);
+
+      if (!line) {
+        break;
+      }
+
+      if (this.labels.has(currentAddress)) {
+        line.label = this.labels.get(currentAddress);
+      }
+
+      if (this.comments.has(currentAddress)) {
+        line.comment = this.comments.get(currentAddress);
+      }
+
+      yield this.enhanceComments ? this.enhanceLineWithReferenceData(line) : line;
+
+      currentAddress += line.instruction.bytes;
+      romOffset += line.instruction.bytes;
+    }
+  }
+
+  /**
+   * Batched form of disassembleStream(): yields fixed-size DisassemblyLine[]
+   * chunks so existing array-based consumers (e.g. formatter.format()) can be
+   * fed incrementally without holding more than one batch in memory.
+   */
+  *disassembleStreamBatches(batchSize: number = 1024, startAddress?: number, endAddress?: number): Generator<DisassemblyLine[], void, undefined> {
+    let batch: DisassemblyLine[] = [];
+
+    for (const line of this.disassembleStream(startAddress, endAddress)) {
+      batch.push(line);
+      if (batch.length >= batchSize) {
+        yield batch;
+        batch = [];
+      }
+    }
+
+    if (batch.length > 0) {
+      yield batch;
+    }
+  }
+
+  /**
+   * Disassemble all ROM banks in parallel using worker threads.
+   *
+   * The ROM bytes are copied once into a SharedArrayBuffer and shared across
+   * workers; banks are partitioned round-robin using BankHandler's bank
+   * geometry, decoded independently (flag state resets at bank boundaries),
+   * and the per-worker results are merged in address order. Decoded banks
+   * are stored in the content-addressed segment cache, so banks whose bytes
+   * match a previously analyzed ROM (e.g. another revision of the same
+   * game) are reused instead of re-decoded. Like the streaming API, this
+   * raw decode pass skips label/comment enhancement and validation - run
+   * analyze() afterwards when those are needed.
+   */
+  async disassembleParallel(options: ParallelDisassemblyOptions = {}): Promise<DisassemblyLine[]> {
+    const bankHandler = new BankHandler(this.rom.cartridgeInfo);
+    const bankSize = bankHandler.getBankSize();
+    const totalBanks = Math.ceil(this.rom.data.length / bankSize);
+
+    // Build one CPU-visible address range per bank, reusing banks already
+    // in the segment cache under the same content hash
+    const cachedLines: DisassemblyLine[][] = [];
+    const missedBanks: Array<{ bank: number; start: number; end: number }> = [];
+    for (let bank = 0; bank < totalBanks; bank++) {
+      const start = bankHandler.romOffsetToAddress(bank * bankSize);
+      const size = Math.min(bankSize, this.rom.data.length - bank * bankSize);
+      const cached = this.cache.getBankDisassembly(this.rom, bank);
+      if (cached) {
+        cachedLines.push(cached);
+      } else {
+        missedBanks.push({ bank, start, end: start + size });
+      }
+    }
+
+    let workerLines: DisassemblyLine[] = [];
+    if (missedBanks.length > 0) {
+      const workerCount = Math.max(1, Math.min(options.workers || os.cpus().length, missedBanks.length));
+      this.logger.info(`Parallel disassembly: ${missedBanks.length}/${totalBanks} banks across ${workerCount} workers (${cachedLines.length} from segment cache)`);
+
+      // Share the ROM bytes once instead of copying them per worker
+      const romBuffer = new SharedArrayBuffer(this.rom.data.length);
+      new Uint8Array(romBuffer).set(this.rom.data);
+
+      // Round-robin bank assignment keeps partitions balanced
+      const partitions: Array<Array<{ start: number; end: number }>> = Array.from({ length: workerCount }, () => []);
+      missedBanks.forEach((range, index) => partitions[index % workerCount].push({ start: range.start, end: range.end }));
+
+      const results = await Promise.all(partitions.map(partition => this.runDisassemblyWorker(romBuffer, partition)));
+      workerLines = results.flat();
+
+      // Store each freshly decoded bank under its content-addressed key
+      const linesByBank = new Map<number, DisassemblyLine[]>();
+      for (const { bank } of missedBanks) {
+        linesByBank.set(bank, []);
+      }
+      for (const line of workerLines) {
+        const bank = Math.floor(bankHandler.addressToRomOffset(line.address) / bankSize);
+        linesByBank.get(bank)?.push(line);
+      }
+      for (const [bank, lines] of linesByBank) {
+        this.cache.setBankDisassembly(this.rom, bank, lines);
+      }
+    } else {
+      this.logger.info(`Parallel disassembly: all ${totalBanks} banks served from segment cache`);
+    }
+
+    const merged = cachedLines.flat().concat(workerLines);
+    merged.sort((a, b) => a.address - b.address);
+    return merged;
+  }
+
+  /**
+   * Spawn a single disassembly worker for a set of bank ranges
+   */
+  private runDisassemblyWorker(romBuffer: SharedArrayBuffer, ranges: Array<{ start: number; end: number }>): Promise<DisassemblyLine[]> {
+    return new Promise((resolve, reject) => {
+      // Under tsx/ts-node __filename is still .ts; spawn the matching worker source
+      const runningFromSource = __filename.endsWith('.ts');
+      const workerFile = path.join(__dirname, `parallel-disassembly-worker.${runningFromSource ? 'ts' : 'js'}`);
+
+      const worker = new Worker(workerFile, {
+        workerData: {
+          romBuffer,
+          romLength: this.rom.data.length,
+          cartridgeInfo: this.rom.cartridgeInfo,
+          ranges
+        },
+        execArgv: runningFromSource ? ['--require', 'tsx/cjs'] : undefined
+      });
+
+      worker.once('message', (lines: DisassemblyLine[]) => {
+        resolve(lines);
+        void worker.terminate();
+      });
+      worker.once('error', reject);
+      worker.once('exit', code => {
+        if (code !== 0) {
+          reject(new Error(`Disassembly worker exited with code ${code}`));
+        }
+      });
+    });
+  }
+
   disassembleFunction(startAddress: number, maxInstructions: number = 100): DisassemblyLine[] {
     const lines: DisassemblyLine[] = [];
     let currentAddress = startAddress;
@@ -327,10 +507,21 @@ this.validationEngine = new SNESValidationEngine(options.validationLogLevel || '
 
   addLabel(address: number, label: string): void {
     this.labels.set(address, label);
+    this.markRangeDirty(address, address);
   }
 
   addComment(address: number, comment: string): void {
     this.comments.set(address, comment);
+    this.markRangeDirty(address, address);
+  }
+
+  /**
+   * Record an address range touched by a mutation (label/comment edit,
+   * re-decoded region) so the next analyze() call can re-run only the
+   * affected basic blocks instead of the full pipeline
+   */
+  markRangeDirty(startAddress: number, endAddress: number): void {
+    this.dirtyRanges.push({ start: startAddress, end: endAddress });
   }
 
   /**
@@ -395,6 +586,56 @@ this.logger.info(`💾 SPC exported to ${outputPath}`);
     return spcBuffer;
   }
 
+  /**
+   * Export a full soundtrack as one SPC file per snapshot.
+   *
+   * exportSPC() per song re-derives engine patterns and audio RAM state
+   * from scratch, which dominates soundtrack exports of 20-40 files.
+   * Here the audio state is extracted (or pulled from cache) once, and
+   * SPCBatchExporter reuses the shared 64KB RAM image and DSP state,
+   * rewriting only the per-song header and RAM patches through a pooled
+   * output buffer. Files are named after each snapshot's song title (or
+   * its index) under outputDir; returns the written paths.
+   */
+  exportSPCBatch(outputDir: string, snapshots: SPCSnapshot[]): string[] {
+this.logger.info(`🎵 Batch-exporting ${snapshots.length} SPC snapshots...`);
+
+    let extractedState = this.cache.getAudioState(this.rom);
+    if (!extractedState) {
+      const lines = this.disassemble();
+      this.analyze();
+      extractedState = SPCStateExtractor.extractAudioState(lines, this.rom.data, this.rom.cartridgeInfo);
+      this.cache.setAudioState(this.rom, extractedState);
+    } else {
+      this.logger.debug('Using cached audio state');
+    }
+
+    const batchExporter = new SPCBatchExporter(
+      extractedState.spc700State as SPC700State,
+      extractedState.dspState as DSPState,
+      {
+        gameTitle: extractedState.metadata.gameTitle || this.rom.header.title.trim() || 'Unknown Game',
+        artist: 'Unknown Artist',
+        dumperName: 'SNESDisassembler',
+        dumpDate: new Date().toLocaleDateString('en-US'),
+        playTime: extractedState.metadata.playTime || 180,
+        fadeLength: extractedState.metadata.fadeLength || 10000
+      }
+    );
+
+    const written: string[] = [];
+    snapshots.forEach((snapshot, index) => {
+      const name = (snapshot.songTitle || `track-${String(index + 1).padStart(2, '0')}`)
+        .replace(/[^A-Za-z0-9._ -]/g, '_');
+      const filePath = path.join(outputDir, `${name}.spc`);
+      batchExporter.exportToFile(filePath, snapshot);
+      written.push(filePath);
+    });
+
+this.logger.info(`💾 Exported ${written.length} SPC files to ${outputDir}`);
+    return written;
+  }
+
   // Enhanced analysis using the analysis engine
   analyze(): { functions: number[], data: number[] } {
     // Prevent recursion by returning early if already analyzing
@@ -418,17 +659,46 @@ this.logger.info(`💾 SPC exported to ${outputPath}`);
       // Skip redundant analysis if context hasn't changed
       if (this.lastAnalysisHash === contextHash) {
         this.logger.debug('Skipping redundant analysis - context unchanged');
+        this.dirtyRanges = [];
         const functions = Array.from(this.analysisEngine.getFunctions().keys());
         const data = Array.from(this.analysisEngine.getDataStructures().keys());
         return { functions, data };
       }
-      
+
+      // Incremental path: a prior analysis exists and we know exactly which
+      // address ranges the edits touched - re-run only the affected blocks
+      // and their CFG neighbors instead of the full pipeline
+      if (this.lastAnalysisHash !== '' && this.dirtyRanges.length > 0) {
+        this.logger.debug('Incremental re-analysis', { dirtyRanges: this.dirtyRanges.length });
+        const lines = this.disassemble();
+        this.analysisEngine.reanalyzeRanges(lines, this.rom.cartridgeInfo, this.dirtyRanges);
+        this.dirtyRanges = [];
+        this.lastAnalysisHash = contextHash;
+
+        const functions = Array.from(this.analysisEngine.getFunctions().keys());
+        const data = Array.from(this.analysisEngine.getDataStructures().keys());
+        const result = { functions, data };
+        this.cache.setFunctions(this.rom, result, analysisContext);
+
+        // Sync regenerated symbols back to labels
+        const symbols = this.analysisEngine.getSymbols();
+        for (const [address, symbol] of symbols) {
+          if (!this.labels.has(address)) {
+            this.labels.set(address, symbol.name);
+          }
+        }
+
+        return result;
+      }
+
+
       // Check cache for function analysis results
       const cachedFunctions = this.cache.getFunctions(this.rom, analysisContext);
       if (cachedFunctions) {
         this.logger.debug('Using cached function analysis');
         this.lastAnalysisHash = contextHash;
-        
+        this.dirtyRanges = [];
+
         // Restore cached symbols to labels
         const symbols = this.analysisEngine.getSymbols();
         for (const [address, symbol] of symbols) {
@@ -483,6 +753,7 @@ this.logger.info(`💾 SPC exported to ${outputPath}`);
       // Cache the analysis results
       this.cache.setFunctions(this.rom, result, analysisContext);
       this.lastAnalysisHash = contextHash;
+      this.dirtyRanges = [];
 
       return result;
     } finally {
@@ -545,6 +816,39 @@ this.logger.info(`💾 SPC exported to ${outputPath}`);
     return formatter.format(lines);
   }
 
+  /**
+   * Format one set of lines into several output formats in a single pass.
+   *
+   * formatOutputAs() per format repeats the symbol conversion, the
+   * cross-reference generation, and a full walk over the lines for every
+   * requested syntax. Here those are computed once and MultiFormatExporter
+   * feeds all formatters line by line from one walk, sharing the
+   * per-operand symbol lookup. Returns output keyed by format name.
+   */
+  formatOutputAsMany(lines: DisassemblyLine[], formats: string[], options: OutputOptions = {}): Map<string, string> {
+    const symbols = this.convertAnalysisSymbolsToOutputFormat();
+    const crossRefs = this.generateCrossReferences(lines);
+
+    const chunksByFormat = new Map<string, Buffer[]>();
+    const targets: ExportTarget[] = formats.map(format => {
+      const chunks: Buffer[] = [];
+      chunksByFormat.set(format, chunks);
+      return {
+        formatter: ExtendedOutputFormatterFactory.create(format, this.rom, symbols, crossRefs, options),
+        // Chunks are views into pooled storage - copy before retaining
+        sink: (chunk: Buffer) => chunks.push(Buffer.from(chunk))
+      };
+    });
+
+    new MultiFormatExporter(targets, symbols).export(lines);
+
+    const output = new Map<string, string>();
+    for (const [format, chunks] of chunksByFormat) {
+      output.set(format, Buffer.concat(chunks).toString('utf8'));
+    }
+    return output;
+  }
+
   /**
    * Export disassembly to file with automatic format detection
    */
@@ -592,6 +896,7 @@ this.logger.debug(output.substring(0, 500) + '...[truncated]');
     for (const [address, symbol] of allSymbols) {
       if (!this.labels.has(address)) {
         this.labels.set(address, symbol.name);
+        this.markRangeDirty(address, address);
       }
     }
 
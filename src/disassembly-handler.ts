@@ -15,7 +15,7 @@ import { extractAssets } from './asset-handler';
 import { EnhancedDisassemblyEngine } from './enhanced-disassembly-engine';
 import { QualityReporter } from './quality-reporter';
 import { ErrorHandler } from './error-handler';
-import { decodeBRRFile, exportToWAV, BRRDecoderOptions } from './brr-decoder';
+import { decodeBRRFile, decodeBRRFileBatched, StreamingWAVWriter, BRRDecoderOptions } from './brr-decoder';
 
 async function processBRRFile(brrFile: string, options: CLIOptions): Promise<void> {
   try {
@@ -29,12 +29,11 @@ async function processBRRFile(brrFile: string, options: CLIOptions): Promise<voi
       outputSampleRate: parseInt(options.brrSampleRate || '32000')
     };
 
-    // Decode BRR file
     const brrData = new Uint8Array(inputFileContent);
-    const decodedResult = decodeBRRFile(brrData, decoderOptions);
 
-    // Show detailed BRR info if requested
+    // Show detailed BRR info if requested (needs the per-block decoder)
     if (options.brrInfo) {
+      const decodedResult = decodeBRRFile(brrData, decoderOptions);
       console.log('BRR File Information:');
       decodedResult.blocks.forEach((block, index) => {
         console.log(`Block ${index + 1}:`, block);
@@ -43,8 +42,16 @@ async function processBRRFile(brrFile: string, options: CLIOptions): Promise<voi
       return;
     }
 
-    // Convert decoded samples to WAV
-    const wavData = exportToWAV(decodedResult.samples, decodedResult.sampleRate);
+    // Decode via the batched kernel and stream straight into WAV chunks
+    const decodedResult = decodeBRRFileBatched(brrData, decoderOptions);
+    const wavChunks: Buffer[] = [];
+    const writer = new StreamingWAVWriter(
+      chunk => wavChunks.push(Buffer.from(chunk)),
+      decodedResult.samples.length,
+      decodedResult.sampleRate
+    );
+    writer.writeSamples(decodedResult.samples);
+    const wavData = Buffer.concat(wavChunks);
 
     // Determine output file name
     let outputFile = options.brrOutput;
@@ -6,7 +6,7 @@
  */
 
 import { SNESDisassembler } from './disassembler';
-import { callMCPTool } from './mcp-integration';
+import { callMCPToolCached } from './mcp-integration';
 import { BankHandler } from './bank-handler';
 import { ROMAnalysisCache, globalROMCache } from './analysis-cache';
 import { SNESRom } from './rom-parser';
@@ -152,7 +152,7 @@ export class EnhancedDisassemblyEngine extends SNESDisassembler {
     
     try {
       // Use MCP server to get vector information
-      const vectorInfo = await callMCPTool('extract_code', {
+      const vectorInfo = await callMCPToolCached('extract_code', {
         data: Array.from(romInfo.data.slice(-0x20)), // Last 32 bytes typically contain vectors
         format: 'ca65',
         extractVectors: true,
@@ -8,6 +8,7 @@
 
 import { Logger, createLogger } from './utils/logger';
 import { DisassemblerError, DisassemblerErrorType } from './types/result-types';
+import * as fs from 'fs';
 
 // Enhanced error types for better categorization
 export enum MessageSeverity {
@@ -47,10 +48,27 @@ export interface ConsolidatedMessage {
     address?: number;
     additionalData?: any;
   }>;
+  /** Set in aggregating mode when context holds a sample, not every occurrence */
+  contextTruncated?: boolean;
   suggestions?: string[];
   relatedMessages?: string[]; // IDs of related messages
 }
 
+export interface ErrorWarningManagerOptions {
+  /**
+   * Aggregating mode: dedupe by consolidation key and keep an exact count
+   * plus a bounded sample of contexts per message, instead of retaining
+   * every raw occurrence. A ROM with a large data region decoded as code
+   * can emit millions of identical warnings; without bounding, both the
+   * raw store and the per-message context arrays grow with each one.
+   */
+  aggregate?: boolean;
+  /** Contexts retained per consolidated message in aggregating mode (default 25) */
+  maxContextSamples?: number;
+  /** When set, every raw occurrence is appended to this file as NDJSON */
+  spillFilePath?: string;
+}
+
 // Session summary interface
 export interface SessionSummary {
   sessionId: string;
@@ -148,10 +166,22 @@ export class ErrorWarningManager {
     operationsCompleted: 0
   };
 
-  constructor(sessionId?: string) {
+  private readonly aggregate: boolean;
+  private readonly maxContextSamples: number;
+  private readonly spillFilePath?: string;
+  private spillStream: fs.WriteStream | null = null;
+
+  /** Pattern matches sampled per message id for summary text generation */
+  private patternMatchSamples: Map<string, RegExpMatchArray[]> = new Map();
+  private static readonly MAX_PATTERN_MATCH_SAMPLES = 5;
+
+  constructor(sessionId?: string, options: ErrorWarningManagerOptions = {}) {
     this.logger = createLogger('ErrorWarningManager');
     this.sessionId = sessionId || this.generateSessionId();
     this.sessionStartTime = new Date();
+    this.aggregate = options.aggregate ?? false;
+    this.maxContextSamples = options.maxContextSamples ?? 25;
+    this.spillFilePath = options.spillFilePath;
     this.logger.info('Error and Warning Manager initialized', { sessionId: this.sessionId });
   }
 
@@ -174,16 +204,24 @@ export class ErrorWarningManager {
   ): void {
     const timestamp = new Date();
     const messageId = this.generateMessageId(severity, category, message);
-    
-    // Store raw message
+
+    // Full stream to disk, when configured; memory keeps only aggregates
+    if (this.spillFilePath) {
+      this.spillRawMessage(severity, category, message, timestamp, context);
+    }
+
+    // Store raw message; aggregating mode keeps a bounded sample per id
     if (!this.rawMessages.has(messageId)) {
       this.rawMessages.set(messageId, []);
     }
-    this.rawMessages.get(messageId)!.push({ timestamp, context });
-    
+    const raw = this.rawMessages.get(messageId)!;
+    if (!this.aggregate || raw.length < this.maxContextSamples) {
+      raw.push({ timestamp, context });
+    }
+
     // Consolidate message
     this.consolidateMessage(messageId, severity, category, message, timestamp, context);
-    
+
     this.messageCounter++;
     this.logger.debug('Message added for consolidation', {
       severity,
@@ -193,6 +231,35 @@ export class ErrorWarningManager {
     });
   }
 
+  private spillRawMessage(
+    severity: MessageSeverity,
+    category: MessageCategory,
+    message: string,
+    timestamp: Date,
+    context?: any
+  ): void {
+    if (!this.spillStream) {
+      this.spillStream = fs.createWriteStream(this.spillFilePath!, { flags: 'a' });
+    }
+    this.spillStream.write(JSON.stringify({
+      timestamp: timestamp.toISOString(),
+      severity,
+      category,
+      message,
+      context
+    }) + '\n');
+  }
+
+  /** Flush and close the spill file, if one is open */
+  closeSpillFile(): Promise<void> {
+    const stream = this.spillStream;
+    this.spillStream = null;
+    if (!stream) {
+      return Promise.resolve();
+    }
+    return new Promise((resolve) => stream.end(resolve));
+  }
+
   /**
    * Add an error (convenience method)
    */
@@ -243,17 +310,32 @@ export class ErrorWarningManager {
     context?: any
   ): void {
     let consolidated = this.consolidatedMessages.get(messageId);
-    
+    const pattern = this.findMatchingPattern(message, category);
+
+    // Summaries only ever render the first few matches, so keep a bounded
+    // sample instead of re-deriving a match per occurrence on every add
+    let matchSamples: RegExpMatchArray[] = [];
+    if (pattern) {
+      matchSamples = this.patternMatchSamples.get(messageId) || [];
+      if (matchSamples.length === 0) {
+        this.patternMatchSamples.set(messageId, matchSamples);
+      }
+      if (matchSamples.length < ErrorWarningManager.MAX_PATTERN_MATCH_SAMPLES) {
+        const match = message.match(pattern.pattern);
+        if (match) {
+          matchSamples.push(match);
+        }
+      }
+    }
+
     if (!consolidated) {
       // Create new consolidated message
-      const pattern = this.findMatchingPattern(message, category);
-      
       consolidated = {
         id: messageId,
         severity,
         category,
-        title: pattern?.generateTitle ? pattern.generateTitle([message.match(pattern.pattern)!]) : this.generateTitle(message),
-        message: pattern?.generateSummary ? pattern.generateSummary(1, [message.match(pattern.pattern)!]) : message,
+        title: pattern?.generateTitle ? pattern.generateTitle(matchSamples) : this.generateTitle(message),
+        message: pattern?.generateSummary ? pattern.generateSummary(1, matchSamples) : message,
         count: 1,
         firstOccurrence: timestamp,
         lastOccurrence: timestamp,
@@ -261,23 +343,23 @@ export class ErrorWarningManager {
         suggestions: pattern?.suggestions || this.generateSuggestions(category, message),
         relatedMessages: []
       };
-      
+
       this.consolidatedMessages.set(messageId, consolidated);
     } else {
       // Update existing consolidated message
       consolidated.count++;
       consolidated.lastOccurrence = timestamp;
-      consolidated.context.push({ timestamp, ...context });
-      
+      if (!this.aggregate || consolidated.context.length < this.maxContextSamples) {
+        consolidated.context.push({ timestamp, ...context });
+      } else {
+        consolidated.contextTruncated = true;
+      }
+
       // Update message summary if using pattern
-      const pattern = this.findMatchingPattern(message, category);
       if (pattern?.generateSummary) {
-        const matches = this.rawMessages.get(messageId)?.map(raw => 
-          message.match(pattern.pattern)!
-        ) || [];
-        consolidated.message = pattern.generateSummary(consolidated.count, matches);
+        consolidated.message = pattern.generateSummary(consolidated.count, matchSamples);
       }
-      
+
       // Update severity if more severe
       if (this.getSeverityWeight(severity) > this.getSeverityWeight(consolidated.severity)) {
         consolidated.severity = severity;
@@ -509,6 +591,7 @@ export class ErrorWarningManager {
   reset(): void {
     this.rawMessages.clear();
     this.consolidatedMessages.clear();
+    this.patternMatchSamples.clear();
     this.messageCounter = 0;
     this.sessionStartTime = new Date();
     this.performanceMetrics = {
@@ -1,8 +1,10 @@
 // Core disassembler functionality
-export { SNESDisassembler } from './disassembler';
-export { RomParser } from './rom-parser';
+export { SNESDisassembler, ParallelDisassemblyOptions } from './disassembler';
+export { RomParser, RomFileReader, SNESRomSummary } from './rom-parser';
 export { InstructionDecoder } from './decoder';
-export { INSTRUCTION_SET } from './instructions';
+export { INSTRUCTION_SET, OPCODE_TABLE, OPCODE_BYTES, OPCODE_BASE_CYCLES } from './instructions';
+export { AnalysisEngine, AddressRange, LineVisitor, CompactControlFlowGraph } from './analysis-engine';
+export { DisassemblyLineStore, LineCursor } from './line-store';
 export * from './types';
 
 // Phase 4: Output & Integration
@@ -13,6 +15,7 @@ export {
   BassFormatter,
   HTMLFormatter,
   JSONFormatter,
+  NDJSONFormatter,
   XMLFormatter,
   CSVFormatter,
   MarkdownFormatter
@@ -20,6 +23,9 @@ export {
 
 export {
   OutputFormatter,
+  PooledLineWriter,
+  MultiFormatExporter,
+  ExportTarget,
   OutputOptions,
   SymbolTableEntry,
   CrossReference
@@ -29,12 +35,14 @@ export {
   SymbolManager,
   SymbolValidationResult,
   SymbolConflict,
-  BulkOperationResult
+  BulkOperationResult,
+  NearestSymbolMatch
 } from './symbol-manager';
 
 // Asset Extraction System
 export {
   AssetExtractor,
+  ParallelExtractionOptions,
   GraphicsExtractor,
   AudioExtractor,
   TextExtractor,
@@ -48,7 +56,9 @@ export {
   TextString,
   DialogueTree,
   GraphicsFormat,
-  TextEncoding
+  TextEncoding,
+  TextCandidateRegion,
+  TextScanOptions
 } from './asset-extractor';
 
 // AI-Enhanced Pattern Recognition
@@ -58,7 +68,11 @@ export {
   AudioClassification,
   TextClassification,
   CompressionInfo,
-  PatternConfidence
+  PatternConfidence,
+  DataRegionClassification,
+  RegionDescriptor,
+  RegionFeatures,
+  BatchClassificationOptions
 } from './ai-pattern-recognition';
 
 // Real AI Model Implementations
@@ -74,6 +88,8 @@ export {
   REGISTER_REFERENCE,
   validateInstruction,
   validateRegister,
+  lookupInstruction,
+  lookupRegister,
   getRegisterInfo,
   generateInstructionComment,
   generateRegisterComment,
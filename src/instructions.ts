@@ -434,4 +434,44 @@ export const INSTRUCTION_SET: Map<number, Instruction> = new Map([
 
   // XCE - Exchange Carry and Emulation
   [0xFB, { opcode: 0xFB, mnemonic: 'XCE', addressingMode: AddressingMode.Implied, bytes: 1, cycles: 2 }]
-]);
\ No newline at end of file
+]);
+
+/**
+ * Dense opcode dispatch tables built once at module load.
+ *
+ * INSTRUCTION_SET stays the authoritative definition, but hashing into a Map
+ * for every byte of a multi-megabyte ROM dominates the decode profile. The
+ * tables below trade 256 entries of memory for direct array indexing:
+ *
+ * - OPCODE_TABLE: frozen Instruction record per opcode (undefined = invalid)
+ * - OPCODE_BYTES: instruction length per opcode (0 = invalid)
+ * - OPCODE_BASE_CYCLES: base cycle count per opcode (CycleInfo.base for
+ *   flag-dependent instructions)
+ *
+ * Hot paths should index these directly instead of calling
+ * INSTRUCTION_SET.get(); the frozen records are safe to share across lines
+ * without per-line cloning.
+ */
+export const OPCODE_TABLE: ReadonlyArray<Instruction | undefined> = (() => {
+  const table: (Instruction | undefined)[] = new Array(256).fill(undefined);
+  for (const [opcode, instruction] of INSTRUCTION_SET) {
+    table[opcode] = Object.freeze({ ...instruction });
+  }
+  return Object.freeze(table) as ReadonlyArray<Instruction | undefined>;
+})();
+
+export const OPCODE_BYTES: Uint8Array = (() => {
+  const bytes = new Uint8Array(256);
+  for (const [opcode, instruction] of INSTRUCTION_SET) {
+    bytes[opcode] = instruction.bytes;
+  }
+  return bytes;
+})();
+
+export const OPCODE_BASE_CYCLES: Uint8Array = (() => {
+  const cycles = new Uint8Array(256);
+  for (const [opcode, instruction] of INSTRUCTION_SET) {
+    cycles[opcode] = typeof instruction.cycles === 'number' ? instruction.cycles : instruction.cycles.base;
+  }
+  return cycles;
+})();
\ No newline at end of file
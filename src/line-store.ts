@@ -0,0 +1,336 @@
+/**
+ * Struct-of-arrays backing store for DisassemblyLine batches.
+ *
+ * A materialized DisassemblyLine costs one object, one bytes array, and
+ * often a cloned Instruction - tens of millions of them per batch crush
+ * the GC, and heap profiles show line objects dominating allocated bytes.
+ * DisassemblyLineStore keeps the same data in flat typed arrays: addresses,
+ * opcodes, byte counts and operands as numeric columns, raw bytes in one
+ * contiguous heap, and labels/comments interned into a shared string table.
+ *
+ * LineCursor is a flyweight over the store that presents the existing
+ * DisassemblyLine interface (including label/comment assignment), so
+ * AnalysisEngine and the formatters work unchanged on toCursorArray()
+ * output. Instruction records are reconstructed from OPCODE_TABLE on
+ * access rather than retained per line; flag-dependent immediates and the
+ * decoder's synthetic DB records come from a small variant cache, and any
+ * instruction that does not round-trip through the table (custom pseudo
+ * ops) falls back to an explicit per-index override map.
+ */
+
+import { DisassemblyLine, Instruction, AddressingMode } from './types';
+import { OPCODE_TABLE } from './instructions';
+
+const NO_STRING = -1;
+const INITIAL_CAPACITY = 1024;
+
+function growUint8(old: Uint8Array, capacity: number): Uint8Array {
+  const grown = new Uint8Array(capacity);
+  grown.set(old);
+  return grown;
+}
+
+function growUint32(old: Uint32Array, capacity: number): Uint32Array {
+  const grown = new Uint32Array(capacity);
+  grown.set(old);
+  return grown;
+}
+
+function growInt32(old: Int32Array, capacity: number, fill: number): Int32Array {
+  const grown = new Int32Array(capacity);
+  if (fill !== 0) grown.fill(fill, old.length);
+  grown.set(old);
+  return grown;
+}
+
+export class DisassemblyLineStore {
+  private count = 0;
+  private addresses: Uint32Array;
+  private opcodes: Uint8Array;
+  private byteCounts: Uint8Array;
+  private operands: Int32Array;
+  private operandPresent: Uint8Array;
+  private byteOffsets: Uint32Array;
+  private labelIds: Int32Array;
+  private commentIds: Int32Array;
+
+  private byteHeap: Uint8Array;
+  private byteHeapUsed = 0;
+
+  private strings: string[] = [];
+  private stringIds = new Map<string, number>();
+
+  /** Keyed on (opcode << 8) | byteCount; holds flag-width and DB variants */
+  private instructionVariants = new Map<number, Instruction>();
+  /** Instructions that cannot be rebuilt from OPCODE_TABLE, by line index */
+  private instructionOverrides = new Map<number, Instruction>();
+
+  constructor(initialCapacity: number = INITIAL_CAPACITY) {
+    const capacity = Math.max(1, initialCapacity);
+    this.addresses = new Uint32Array(capacity);
+    this.opcodes = new Uint8Array(capacity);
+    this.byteCounts = new Uint8Array(capacity);
+    this.operands = new Int32Array(capacity);
+    this.operandPresent = new Uint8Array(capacity);
+    this.byteOffsets = new Uint32Array(capacity);
+    this.labelIds = new Int32Array(capacity).fill(NO_STRING);
+    this.commentIds = new Int32Array(capacity).fill(NO_STRING);
+    this.byteHeap = new Uint8Array(capacity * 3);
+  }
+
+  /** Bulk-load an existing materialized line array */
+  static fromLines(lines: DisassemblyLine[]): DisassemblyLineStore {
+    const store = new DisassemblyLineStore(lines.length);
+    for (const line of lines) {
+      store.push(line);
+    }
+    return store;
+  }
+
+  get length(): number {
+    return this.count;
+  }
+
+  /** Append a line, returning its index in the store */
+  push(line: DisassemblyLine): number {
+    this.ensureCapacity(this.count + 1);
+    const index = this.count++;
+
+    this.addresses[index] = line.address;
+    this.opcodes[index] = line.instruction.opcode;
+    this.byteCounts[index] = line.bytes.length;
+
+    this.byteOffsets[index] = this.byteHeapUsed;
+    this.ensureByteHeap(line.bytes.length);
+    for (let i = 0; i < line.bytes.length; i++) {
+      this.byteHeap[this.byteHeapUsed++] = line.bytes[i];
+    }
+
+    if (line.operand !== undefined) {
+      this.operands[index] = line.operand;
+      this.operandPresent[index] = 1;
+    }
+    if (line.label !== undefined) {
+      this.labelIds[index] = this.internString(line.label);
+    }
+    if (line.comment !== undefined) {
+      this.commentIds[index] = this.internString(line.comment);
+    }
+
+    // Keep the original record only when reconstruction would not
+    // reproduce it - otherwise the columns above carry everything
+    const rebuilt = this.instructionFor(line.instruction.opcode, line.bytes.length);
+    if (rebuilt.mnemonic !== line.instruction.mnemonic ||
+        rebuilt.addressingMode !== line.instruction.addressingMode ||
+        rebuilt.bytes !== line.instruction.bytes) {
+      this.instructionOverrides.set(index, line.instruction);
+    }
+
+    return index;
+  }
+
+  addressAt(index: number): number {
+    return this.addresses[index];
+  }
+
+  /** Materializes a fresh number[] on every call; prefer columnar reads in hot loops */
+  bytesAt(index: number): number[] {
+    const start = this.byteOffsets[index];
+    const bytes: number[] = new Array(this.byteCounts[index]);
+    for (let i = 0; i < bytes.length; i++) {
+      bytes[i] = this.byteHeap[start + i];
+    }
+    return bytes;
+  }
+
+  opcodeAt(index: number): number {
+    return this.opcodes[index];
+  }
+
+  instructionAt(index: number): Instruction {
+    const override = this.instructionOverrides.get(index);
+    if (override) return override;
+    return this.instructionFor(this.opcodes[index], this.byteCounts[index]);
+  }
+
+  operandAt(index: number): number | undefined {
+    return this.operandPresent[index] ? this.operands[index] : undefined;
+  }
+
+  setOperandAt(index: number, operand: number | undefined): void {
+    if (operand === undefined) {
+      this.operandPresent[index] = 0;
+    } else {
+      this.operands[index] = operand;
+      this.operandPresent[index] = 1;
+    }
+  }
+
+  labelAt(index: number): string | undefined {
+    const id = this.labelIds[index];
+    return id === NO_STRING ? undefined : this.strings[id];
+  }
+
+  setLabelAt(index: number, label: string | undefined): void {
+    this.labelIds[index] = label === undefined ? NO_STRING : this.internString(label);
+  }
+
+  commentAt(index: number): string | undefined {
+    const id = this.commentIds[index];
+    return id === NO_STRING ? undefined : this.strings[id];
+  }
+
+  setCommentAt(index: number, comment: string | undefined): void {
+    this.commentIds[index] = comment === undefined ? NO_STRING : this.internString(comment);
+  }
+
+  /**
+   * Position a cursor at the given index, reusing the supplied cursor when
+   * provided so tight loops allocate nothing per line
+   */
+  cursorAt(index: number, cursor?: LineCursor): LineCursor {
+    if (cursor) {
+      cursor.index = index;
+      return cursor;
+    }
+    return new LineCursor(this, index);
+  }
+
+  /**
+   * One cursor per line, typed as DisassemblyLine[] so existing consumers
+   * (AnalysisEngine, formatters) work unchanged. Each element is a small
+   * fixed-shape flyweight; columnar data stays in the store.
+   */
+  toCursorArray(): DisassemblyLine[] {
+    const cursors: DisassemblyLine[] = new Array(this.count);
+    for (let i = 0; i < this.count; i++) {
+      cursors[i] = new LineCursor(this, i);
+    }
+    return cursors;
+  }
+
+  /** Copy one line out as a plain, store-independent object */
+  materialize(index: number): DisassemblyLine {
+    const line: DisassemblyLine = {
+      address: this.addresses[index],
+      bytes: this.bytesAt(index),
+      instruction: this.instructionAt(index)
+    };
+    const operand = this.operandAt(index);
+    if (operand !== undefined) line.operand = operand;
+    const label = this.labelAt(index);
+    if (label !== undefined) line.label = label;
+    const comment = this.commentAt(index);
+    if (comment !== undefined) line.comment = comment;
+    return line;
+  }
+
+  /**
+   * Visit every line through a single reused cursor. The cursor is only
+   * valid inside the callback - copy via materialize() to retain a line.
+   */
+  forEach(visit: (line: LineCursor, index: number) => void): void {
+    const cursor = new LineCursor(this, 0);
+    for (let i = 0; i < this.count; i++) {
+      cursor.index = i;
+      visit(cursor, i);
+    }
+  }
+
+  private internString(value: string): number {
+    const existing = this.stringIds.get(value);
+    if (existing !== undefined) return existing;
+    const id = this.strings.length;
+    this.strings.push(value);
+    this.stringIds.set(value, id);
+    return id;
+  }
+
+  private instructionFor(opcode: number, byteCount: number): Instruction {
+    const table = OPCODE_TABLE[opcode];
+    if (table && table.bytes === byteCount) {
+      return table;
+    }
+    const key = (opcode << 8) | byteCount;
+    let variant = this.instructionVariants.get(key);
+    if (!variant) {
+      variant = table
+        ? { ...table, bytes: byteCount }
+        : {
+          // Mirrors the decoder's unknown-opcode DB record
+          opcode,
+          mnemonic: 'DB',
+          addressingMode: AddressingMode.Immediate,
+          bytes: byteCount,
+          cycles: 0
+        };
+      this.instructionVariants.set(key, variant);
+    }
+    return variant;
+  }
+
+  private ensureCapacity(needed: number): void {
+    if (needed <= this.addresses.length) return;
+    const capacity = Math.max(this.addresses.length * 2, needed);
+    this.addresses = growUint32(this.addresses, capacity);
+    this.opcodes = growUint8(this.opcodes, capacity);
+    this.byteCounts = growUint8(this.byteCounts, capacity);
+    this.operands = growInt32(this.operands, capacity, 0);
+    this.operandPresent = growUint8(this.operandPresent, capacity);
+    this.byteOffsets = growUint32(this.byteOffsets, capacity);
+    this.labelIds = growInt32(this.labelIds, capacity, NO_STRING);
+    this.commentIds = growInt32(this.commentIds, capacity, NO_STRING);
+  }
+
+  private ensureByteHeap(bytes: number): void {
+    if (this.byteHeapUsed + bytes <= this.byteHeap.length) return;
+    const grown = new Uint8Array(Math.max(this.byteHeap.length * 2, this.byteHeapUsed + bytes));
+    grown.set(this.byteHeap);
+    this.byteHeap = grown;
+  }
+}
+
+/**
+ * Flyweight DisassemblyLine view into a DisassemblyLineStore. Holds only a
+ * store reference and an index; every property reads through to the
+ * store's columns, and label/comment/operand writes intern back into it.
+ */
+export class LineCursor implements DisassemblyLine {
+  constructor(private store: DisassemblyLineStore, public index: number) {}
+
+  get address(): number {
+    return this.store.addressAt(this.index);
+  }
+
+  get bytes(): number[] {
+    return this.store.bytesAt(this.index);
+  }
+
+  get instruction(): Instruction {
+    return this.store.instructionAt(this.index);
+  }
+
+  get operand(): number | undefined {
+    return this.store.operandAt(this.index);
+  }
+
+  set operand(value: number | undefined) {
+    this.store.setOperandAt(this.index, value);
+  }
+
+  get label(): string | undefined {
+    return this.store.labelAt(this.index);
+  }
+
+  set label(value: string | undefined) {
+    this.store.setLabelAt(this.index, value);
+  }
+
+  get comment(): string | undefined {
+    return this.store.commentAt(this.index);
+  }
+
+  set comment(value: string | undefined) {
+    this.store.setCommentAt(this.index, value);
+  }
+}
@@ -6,6 +6,11 @@
  * replaced with actual MCP server connections.
  */
 
+import * as crypto from 'crypto';
+import * as fs from 'fs';
+import * as os from 'os';
+import * as path from 'path';
+
 export interface MCPToolOptions {
   data?: number[];
   format?: string;
@@ -40,6 +45,165 @@ export async function callMCPTool(toolName: string, options: MCPToolOptions): Pr
   }
 }
 
+export interface MCPCacheOptions {
+  /** In-memory LRU capacity (default 512 responses) */
+  maxEntries?: number;
+  /**
+   * Directory for the persistent response store; null disables disk
+   * persistence. Defaults to ~/.snes-disasm/mcp-cache.
+   */
+  cacheDir?: string | null;
+}
+
+/**
+ * Caching layer over callMCPTool().
+ *
+ * Annotation runs issue many near-identical reference lookups, so every
+ * query is keyed by a hash of (toolName, options) with object keys
+ * canonicalized. Three layers sit in front of the server: concurrent
+ * identical requests coalesce onto one in-flight promise, resolved
+ * responses live in an in-memory LRU, and each response is persisted as
+ * <hash>.json in the cache directory so repeat runs hit disk instead of
+ * the network. Rejected calls are never cached.
+ */
+export class MCPResponseCache {
+  private readonly maxEntries: number;
+  private readonly cacheDir: string | null;
+  private cacheDirReady = false;
+
+  /** LRU: Map iteration order is insertion order; gets re-insert */
+  private memory = new Map<string, any>();
+  private inFlight = new Map<string, Promise<any>>();
+
+  constructor(options: MCPCacheOptions = {}) {
+    this.maxEntries = options.maxEntries ?? 512;
+    this.cacheDir = options.cacheDir === undefined
+      ? path.join(os.homedir(), '.snes-disasm', 'mcp-cache')
+      : options.cacheDir;
+  }
+
+  async call(toolName: string, options: MCPToolOptions): Promise<any> {
+    const key = this.queryHash(toolName, options);
+
+    const memoized = this.memory.get(key);
+    if (memoized !== undefined) {
+      // Refresh LRU position
+      this.memory.delete(key);
+      this.memory.set(key, memoized);
+      return memoized;
+    }
+
+    const pending = this.inFlight.get(key);
+    if (pending) {
+      return pending;
+    }
+
+    const request = this.resolve(toolName, options, key);
+    this.inFlight.set(key, request);
+    try {
+      return await request;
+    } finally {
+      this.inFlight.delete(key);
+    }
+  }
+
+  /** Drop the in-memory layer; the disk store is left intact */
+  clearMemory(): void {
+    this.memory.clear();
+  }
+
+  private async resolve(toolName: string, options: MCPToolOptions, key: string): Promise<any> {
+    const persisted = this.readFromDisk(key);
+    if (persisted !== undefined) {
+      this.remember(key, persisted);
+      return persisted;
+    }
+
+    const response = await callMCPTool(toolName, options);
+    this.remember(key, response);
+    this.writeToDisk(key, toolName, response);
+    return response;
+  }
+
+  private remember(key: string, response: any): void {
+    if (this.memory.size >= this.maxEntries) {
+      const oldest = this.memory.keys().next().value;
+      if (oldest !== undefined) {
+        this.memory.delete(oldest);
+      }
+    }
+    this.memory.set(key, response);
+  }
+
+  /** Hash of the query with object keys canonicalized, so equivalent
+   *  options objects collide regardless of property order */
+  private queryHash(toolName: string, options: MCPToolOptions): string {
+    const hash = crypto.createHash('sha256');
+    hash.update(toolName);
+    hash.update('\0');
+    hash.update(this.canonicalize(options));
+    return hash.digest('hex');
+  }
+
+  private canonicalize(value: any): string {
+    if (value === null || typeof value !== 'object') {
+      return JSON.stringify(value) ?? 'undefined';
+    }
+    if (Array.isArray(value)) {
+      // Fast path for ROM byte payloads: number arrays need no per-element
+      // recursion and dominate the hashing cost for large queries
+      if (value.every(v => typeof v === 'number')) {
+        return `[${value.join(',')}]`;
+      }
+      return `[${value.map(v => this.canonicalize(v)).join(',')}]`;
+    }
+    const keys = Object.keys(value).sort();
+    return `{${keys.map(k => `${JSON.stringify(k)}:${this.canonicalize(value[k])}`).join(',')}}`;
+  }
+
+  private diskPath(key: string): string {
+    return path.join(this.cacheDir!, `${key}.json`);
+  }
+
+  private readFromDisk(key: string): any {
+    if (!this.cacheDir) {
+      return undefined;
+    }
+    try {
+      const raw = fs.readFileSync(this.diskPath(key), 'utf8');
+      return JSON.parse(raw).response;
+    } catch {
+      return undefined;
+    }
+  }
+
+  private writeToDisk(key: string, toolName: string, response: any): void {
+    if (!this.cacheDir) {
+      return;
+    }
+    try {
+      if (!this.cacheDirReady) {
+        fs.mkdirSync(this.cacheDir, { recursive: true });
+        this.cacheDirReady = true;
+      }
+      fs.writeFileSync(this.diskPath(key), JSON.stringify({ toolName, response }));
+    } catch {
+      // A read-only or full disk must not fail the lookup itself
+    }
+  }
+}
+
+/** Shared cache instance used by callMCPToolCached() */
+export const mcpResponseCache = new MCPResponseCache();
+
+/**
+ * Cached variant of callMCPTool(); identical concurrent requests share
+ * one in-flight call and repeat queries are served from memory or disk
+ */
+export async function callMCPToolCached(toolName: string, options: MCPToolOptions): Promise<any> {
+  return mcpResponseCache.call(toolName, options);
+}
+
 /**
  * Check if MCP integration is available
  */
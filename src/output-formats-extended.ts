@@ -3,7 +3,7 @@
  *
  * Additional output formats for documentation, analysis, and integration:
  * - HTML with hyperlinked cross-references
- * - JSON export for external tools
+ * - JSON export for external tools (plus streaming NDJSON)
  * - XML output format
  * - CSV export for spreadsheet analysis
  * - Markdown documentation
@@ -207,42 +207,50 @@ export class JSONFormatter extends OutputFormatter {
 
   format(lines: DisassemblyLine[]): string {
     const data = {
-      metadata: {
-        title: this.rom.header.title,
-        cartridgeType: this.rom.cartridgeInfo.type,
-        romSize: this.rom.cartridgeInfo.romSize,
-        resetVector: this.rom.header.nativeVectors.reset,
-        specialChip: this.rom.cartridgeInfo.specialChip,
-        generatedBy: 'SNES Disassembler',
-        generatedAt: new Date().toISOString(),
-        format: 'JSON'
-      },
+      metadata: this.serializeMetadata('JSON'),
       symbols: this.serializeSymbols(),
       crossReferences: this.crossRefs,
-      disassembly: lines.map(line => ({
-        address: line.address,
-        addressHex: line.address.toString(16).toUpperCase().padStart(6, '0'),
-        bytes: line.bytes,
-        bytesHex: line.bytes.map(b => b.toString(16).toUpperCase().padStart(2, '0')),
-        instruction: {
-          opcode: line.instruction.opcode,
-          mnemonic: line.instruction.mnemonic,
-          addressingMode: line.instruction.addressingMode,
-          bytes: line.instruction.bytes,
-          cycles: line.instruction.cycles
-        },
-        operand: line.operand,
-        operandHex: line.operand?.toString(16).toUpperCase().padStart(line.operand <= 0xFF ? 2 : line.operand <= 0xFFFF ? 4 : 6, '0'),
-        label: line.label,
-        comment: line.comment
-      }))
+      disassembly: lines.map(line => this.serializeLine(line))
     };
 
     return JSON.stringify(data, null, 2);
   }
 
-  private serializeSymbols(): any[] {
-    return Array.from(this.symbols.entries()).map(([address, symbol]) => ({
+  protected serializeMetadata(format: string): any {
+    return {
+      title: this.rom.header.title,
+      cartridgeType: this.rom.cartridgeInfo.type,
+      romSize: this.rom.cartridgeInfo.romSize,
+      resetVector: this.rom.header.nativeVectors.reset,
+      specialChip: this.rom.cartridgeInfo.specialChip,
+      generatedBy: 'SNES Disassembler',
+      generatedAt: new Date().toISOString(),
+      format
+    };
+  }
+
+  protected serializeLine(line: DisassemblyLine): any {
+    return {
+      address: line.address,
+      addressHex: line.address.toString(16).toUpperCase().padStart(6, '0'),
+      bytes: line.bytes,
+      bytesHex: line.bytes.map(b => b.toString(16).toUpperCase().padStart(2, '0')),
+      instruction: {
+        opcode: line.instruction.opcode,
+        mnemonic: line.instruction.mnemonic,
+        addressingMode: line.instruction.addressingMode,
+        bytes: line.instruction.bytes,
+        cycles: line.instruction.cycles
+      },
+      operand: line.operand,
+      operandHex: line.operand?.toString(16).toUpperCase().padStart(line.operand <= 0xFF ? 2 : line.operand <= 0xFFFF ? 4 : 6, '0'),
+      label: line.label,
+      comment: line.comment
+    };
+  }
+
+  protected serializeSymbol(address: number, symbol: SymbolTableEntry): any {
+    return {
       address,
       addressHex: address.toString(16).toUpperCase().padStart(6, '0'),
       name: symbol.name,
@@ -251,7 +259,55 @@ export class JSONFormatter extends OutputFormatter {
       size: symbol.size,
       description: symbol.description,
       references: symbol.references
-    }));
+    };
+  }
+
+  private serializeSymbols(): any[] {
+    return Array.from(this.symbols.entries()).map(([address, symbol]) => this.serializeSymbol(address, symbol));
+  }
+}
+
+/**
+ * Newline-delimited JSON export for feeding disassembly into analytics
+ * pipelines. One self-describing record per line, tagged by a `record`
+ * field: metadata first, then symbols, cross-references, and disassembly
+ * lines. formatToStream() emits record-by-record, so peak memory stays
+ * independent of line count; format() produces the same bytes in one
+ * string for callers that want them.
+ */
+export class NDJSONFormatter extends JSONFormatter {
+  getName(): string {
+    return 'NDJSON';
+  }
+
+  getFileExtension(): string {
+    return '.ndjson';
+  }
+
+  format(lines: DisassemblyLine[]): string {
+    const records: string[] = [];
+    this.emitRecords(lines, record => records.push(record));
+    return records.join('');
+  }
+
+  formatToStream(lines: DisassemblyLine[], sink: (chunk: Buffer) => void): void {
+    this.emitRecords(lines, record => sink(Buffer.from(record, 'utf8')));
+  }
+
+  private emitRecords(lines: DisassemblyLine[], emit: (record: string) => void): void {
+    emit(JSON.stringify({ record: 'metadata', ...this.serializeMetadata('NDJSON') }) + '\n');
+
+    for (const [address, symbol] of this.symbols) {
+      emit(JSON.stringify({ record: 'symbol', ...this.serializeSymbol(address, symbol) }) + '\n');
+    }
+
+    for (const ref of this.crossRefs) {
+      emit(JSON.stringify({ record: 'cross-reference', ...ref }) + '\n');
+    }
+
+    for (const line of lines) {
+      emit(JSON.stringify({ record: 'line', ...this.serializeLine(line) }) + '\n');
+    }
   }
 }
 
@@ -380,7 +436,30 @@ export class CSVFormatter extends OutputFormatter {
   format(lines: DisassemblyLine[]): string {
     const output: string[] = [];
 
-    // CSV Header
+    output.push(this.headerRow());
+
+    // CSV Data
+    for (const line of lines) {
+      output.push(this.formatRow(line));
+    }
+
+    return output.join('\n');
+  }
+
+  /**
+   * Streaming variant: emit the header and each row as its own chunk so
+   * peak memory stays independent of line count. Byte-identical to
+   * format().
+   */
+  formatToStream(lines: DisassemblyLine[], sink: (chunk: Buffer) => void): void {
+    sink(Buffer.from(this.headerRow(), 'utf8'));
+
+    for (const line of lines) {
+      sink(Buffer.from('\n' + this.formatRow(line), 'utf8'));
+    }
+  }
+
+  private headerRow(): string {
     const headers = [
       'Address',
       'AddressHex',
@@ -399,34 +478,31 @@ export class CSVFormatter extends OutputFormatter {
       'Comment'
     ];
 
-    output.push(headers.join(','));
+    return headers.join(',');
+  }
 
-    // CSV Data
-    for (const line of lines) {
-      const row = [
-        line.address.toString(),
-        `"${line.address.toString(16).toUpperCase().padStart(6, '0')}"`,
-        `"${line.bytes.join(' ')}"`,
-        `"${line.bytes.map(b => b.toString(16).toUpperCase().padStart(2, '0')).join(' ')}"`,
-        line.instruction.opcode.toString(),
-        `"${line.instruction.opcode.toString(16).toUpperCase().padStart(2, '0')}"`,
-        `"${line.instruction.mnemonic}"`,
-        `"${line.instruction.addressingMode}"`,
-        line.instruction.bytes.toString(),
-        typeof line.instruction.cycles === 'number' ?
-          line.instruction.cycles.toString() :
-          line.instruction.cycles.base.toString(),
-        line.operand?.toString() || '',
-        line.operand ? `"${line.operand.toString(16).toUpperCase()}"` : '""',
-        `"${this.formatOperand(line)}"`,
-        line.label ? `"${line.label}"` : '""',
-        line.comment ? `"${line.comment.replace(/"/g, '""')}"` : '""'
-      ];
-
-      output.push(row.join(','));
-    }
+  private formatRow(line: DisassemblyLine): string {
+    const row = [
+      line.address.toString(),
+      `"${line.address.toString(16).toUpperCase().padStart(6, '0')}"`,
+      `"${line.bytes.join(' ')}"`,
+      `"${line.bytes.map(b => b.toString(16).toUpperCase().padStart(2, '0')).join(' ')}"`,
+      line.instruction.opcode.toString(),
+      `"${line.instruction.opcode.toString(16).toUpperCase().padStart(2, '0')}"`,
+      `"${line.instruction.mnemonic}"`,
+      `"${line.instruction.addressingMode}"`,
+      line.instruction.bytes.toString(),
+      typeof line.instruction.cycles === 'number' ?
+        line.instruction.cycles.toString() :
+        line.instruction.cycles.base.toString(),
+      line.operand?.toString() || '',
+      line.operand ? `"${line.operand.toString(16).toUpperCase()}"` : '""',
+      `"${this.formatOperand(line)}"`,
+      line.label ? `"${line.label}"` : '""',
+      line.comment ? `"${line.comment.replace(/"/g, '""')}"` : '""'
+    ];
 
-    return output.join('\n');
+    return row.join(',');
   }
 }
 
@@ -542,6 +618,8 @@ export class ExtendedOutputFormatterFactory {
       return new HTMLFormatter(rom, symbols, crossRefs, options);
     case 'json':
       return new JSONFormatter(rom, symbols, crossRefs, options);
+    case 'ndjson':
+      return new NDJSONFormatter(rom, symbols, crossRefs, options);
     case 'xml':
       return new XMLFormatter(rom, symbols, crossRefs, options);
     case 'csv':
@@ -555,7 +633,7 @@ export class ExtendedOutputFormatterFactory {
   }
 
   static getSupportedFormats(): string[] {
-    return ['ca65', 'wla-dx', 'bass', 'html', 'json', 'xml', 'csv', 'markdown'];
+    return ['ca65', 'wla-dx', 'bass', 'html', 'json', 'ndjson', 'xml', 'csv', 'markdown'];
   }
 }
 
@@ -42,6 +42,145 @@ export interface CrossReference {
   instruction?: string;
 }
 
+// Cached hex-conversion lookup tables. Byte tables are built eagerly (256
+// entries), the 16-bit table lazily on first streaming format since it holds
+// 65536 strings.
+const HEX_BYTE_UPPER: string[] = new Array(256);
+const HEX_BYTE_LOWER: string[] = new Array(256);
+for (let i = 0; i < 256; i++) {
+  const hex = i.toString(16).padStart(2, '0');
+  HEX_BYTE_LOWER[i] = hex;
+  HEX_BYTE_UPPER[i] = hex.toUpperCase();
+}
+
+let hexWordUpper: string[] | null = null;
+
+function hexWordTable(): string[] {
+  if (hexWordUpper === null) {
+    hexWordUpper = new Array(0x10000);
+    for (let i = 0; i < 0x10000; i++) {
+      hexWordUpper[i] = i.toString(16).toUpperCase().padStart(4, '0');
+    }
+  }
+  return hexWordUpper;
+}
+
+/**
+ * Pooled output writer for the zero-allocation formatter fast path.
+ *
+ * Formatting a full ROM through format() builds millions of short-lived
+ * strings (template literals, padStart/padEnd intermediates, array joins).
+ * This writer appends directly into one reusable preallocated buffer and
+ * hands large chunks to a sink callback whenever the buffer fills, so the
+ * per-line cost is a handful of buffer writes and table lookups.
+ *
+ * The Buffer passed to the sink is a view into the pooled storage and is
+ * only valid for the duration of the callback - consume or copy it before
+ * returning.
+ */
+export class PooledLineWriter {
+  private buffer: Buffer;
+  private offset = 0;
+  private recordChars = 0;
+
+  constructor(private sink: (chunk: Buffer) => void, capacity: number = 256 * 1024) {
+    this.buffer = Buffer.allocUnsafe(capacity);
+  }
+
+  /** Mark the start of a logical output record; padTo() measures from here */
+  beginRecord(): void {
+    this.recordChars = 0;
+  }
+
+  /** Characters written since beginRecord() */
+  get recordLength(): number {
+    return this.recordChars;
+  }
+
+  private ensure(bytes: number): void {
+    if (this.offset + bytes > this.buffer.length) {
+      this.flush();
+      if (bytes > this.buffer.length) {
+        this.buffer = Buffer.allocUnsafe(bytes);
+      }
+    }
+  }
+
+  text(value: string): void {
+    this.ensure(value.length * 4); // worst-case UTF-8 expansion
+    this.offset += this.buffer.write(value, this.offset, 'utf8');
+    this.recordChars += value.length;
+  }
+
+  textPadded(value: string, width: number): void {
+    this.text(value);
+    if (value.length < width) {
+      this.pad(width - value.length);
+    }
+  }
+
+  pad(count: number): void {
+    this.ensure(count);
+    this.buffer.fill(0x20, this.offset, this.offset + count);
+    this.offset += count;
+    this.recordChars += count;
+  }
+
+  /** Pad the current record with spaces out to the given column (padEnd) */
+  padTo(column: number): void {
+    if (this.recordChars < column) {
+      this.pad(column - this.recordChars);
+    }
+  }
+
+  hexByte(value: number, uppercase: boolean = true): void {
+    this.text((uppercase ? HEX_BYTE_UPPER : HEX_BYTE_LOWER)[value & 0xFF]);
+  }
+
+  hexWord(value: number, uppercase: boolean = true): void {
+    if (uppercase) {
+      this.text(hexWordTable()[value & 0xFFFF]);
+    } else {
+      this.text((value & 0xFFFF).toString(16).padStart(4, '0'));
+    }
+  }
+
+  /** 24-bit address as six hex digits */
+  hexAddress(value: number, uppercase: boolean = true): void {
+    this.hexByte((value >>> 16) & 0xFF, uppercase);
+    this.hexWord(value & 0xFFFF, uppercase);
+  }
+
+  /** Uppercase hex with at least minDigits digits (padStart semantics) */
+  hexMin(value: number, minDigits: number): void {
+    if (minDigits === 2 && value <= 0xFF) {
+      this.text(HEX_BYTE_UPPER[value]);
+    } else if (minDigits === 4 && value <= 0xFFFF) {
+      this.text(hexWordTable()[value]);
+    } else if (minDigits === 6 && value <= 0xFFFFFF) {
+      this.hexAddress(value);
+    } else {
+      this.text(value.toString(16).toUpperCase().padStart(minDigits, '0'));
+    }
+  }
+
+  hexBytes(bytes: number[], uppercase: boolean = true): void {
+    for (let i = 0; i < bytes.length; i++) {
+      if (i > 0) {
+        this.text(' ');
+      }
+      this.hexByte(bytes[i], uppercase);
+    }
+  }
+
+  flush(): void {
+    if (this.offset > 0) {
+      this.sink(this.buffer.subarray(0, this.offset));
+      this.offset = 0;
+    }
+  }
+}
+
 export abstract class OutputFormatter {
   protected rom: SNESRom;
   protected symbols: Map<number, SymbolTableEntry>;
@@ -67,10 +206,52 @@ export abstract class OutputFormatter {
     };
   }
 
+  private streamSink: ((chunk: Buffer) => void) | null = null;
+  private streamedLines: DisassemblyLine[] | null = null;
+
   abstract format(lines: DisassemblyLine[]): string;
   abstract getFileExtension(): string;
   abstract getName(): string;
 
+  /**
+   * Streaming fast path: write the formatted output to a sink in large
+   * chunks instead of returning one giant string. Subclasses override this
+   * with a pooled-writer implementation; the default falls back to format().
+   * Output is byte-identical to format().
+   */
+  formatToStream(lines: DisassemblyLine[], sink: (chunk: Buffer) => void): void {
+    sink(Buffer.from(this.format(lines), 'utf8'));
+  }
+
+  /**
+   * Incremental streaming protocol backing MultiFormatExporter: one
+   * beginStream(), then writeLine() per line, then endStream(). Output is
+   * byte-identical to formatToStream() over the same lines. The default
+   * implementation buffers lines and formats them at endStream(), so every
+   * formatter participates; the assembler formatters override all three
+   * with a pooled-writer fast path that holds no line buffer at all.
+   *
+   * operandSymbol carries a symbol-table lookup already performed by the
+   * caller for this line's operand (null when the lookup found nothing),
+   * so several formatters sharing one symbol table resolve it once.
+   */
+  beginStream(sink: (chunk: Buffer) => void): void {
+    this.streamSink = sink;
+    this.streamedLines = [];
+  }
+
+  writeLine(line: DisassemblyLine, operandSymbol?: string | null): void {
+    this.streamedLines?.push(line);
+  }
+
+  endStream(): void {
+    if (this.streamSink && this.streamedLines) {
+      this.formatToStream(this.streamedLines, this.streamSink);
+    }
+    this.streamSink = null;
+    this.streamedLines = null;
+  }
+
   protected formatAddress(address: number): string {
     const hex = address.toString(16).toUpperCase();
     return this.options.uppercase ? `$${hex.padStart(6, '0')}` : `$${hex.padStart(6, '0').toLowerCase()}`;
@@ -157,6 +338,8 @@ export abstract class OutputFormatter {
 }
 
 export class CA65Formatter extends OutputFormatter {
+  private streamWriter: PooledLineWriter | null = null;
+
   getName(): string {
     return 'CA65';
   }
@@ -166,6 +349,43 @@ export class CA65Formatter extends OutputFormatter {
   }
 
   format(lines: DisassemblyLine[]): string {
+    const output = this.buildPreamble();
+
+    // Format disassembly lines
+    for (const line of lines) {
+      const formattedLine = this.formatCA65Line(line);
+      if (formattedLine) {
+        output.push(formattedLine);
+      }
+    }
+
+    return output.join('\n');
+  }
+
+  formatToStream(lines: DisassemblyLine[], sink: (chunk: Buffer) => void): void {
+    this.beginStream(sink);
+    for (const line of lines) {
+      this.writeLine(line);
+    }
+    this.endStream();
+  }
+
+  beginStream(sink: (chunk: Buffer) => void): void {
+    this.streamWriter = new PooledLineWriter(sink);
+    this.streamWriter.text(this.buildPreamble().join('\n'));
+  }
+
+  writeLine(line: DisassemblyLine, operandSymbol?: string | null): void {
+    this.streamWriter!.text('\n');
+    this.emitCA65Line(this.streamWriter!, line, operandSymbol);
+  }
+
+  endStream(): void {
+    this.streamWriter!.flush();
+    this.streamWriter = null;
+  }
+
+  private buildPreamble(): string[] {
     const output: string[] = [];
 
     // Add assembler-specific directives
@@ -189,15 +409,7 @@ export class CA65Formatter extends OutputFormatter {
       output.push('');
     }
 
-    // Format disassembly lines
-    for (const line of lines) {
-      const formattedLine = this.formatCA65Line(line);
-      if (formattedLine) {
-        output.push(formattedLine);
-      }
-    }
-
-    return output.join('\n');
+    return output;
   }
 
   private addMemoryMapping(output: string[]): void {
@@ -272,9 +484,90 @@ export class CA65Formatter extends OutputFormatter {
 
     return output;
   }
+
+  /** Pooled-writer equivalent of formatCA65Line */
+  private emitCA65Line(writer: PooledLineWriter, line: DisassemblyLine, operandSymbol?: string | null): void {
+    const uppercase = this.options.uppercase !== false;
+    writer.beginRecord();
+
+    if (line.label) {
+      writer.text(line.label);
+      writer.text(':\n');
+    }
+
+    writer.text('    ');
+
+    if (this.options.lineNumbers) {
+      writer.hexAddress(line.address);
+      writer.text(': ');
+    }
+
+    if (this.options.includeBytes) {
+      writer.text('; ');
+      const bytesStart = writer.recordLength;
+      writer.hexBytes(line.bytes, uppercase);
+      writer.padTo(bytesStart + 12);
+      writer.text(' ');
+    }
+
+    const mnemonic = uppercase ?
+      line.instruction.mnemonic.toUpperCase() :
+      line.instruction.mnemonic.toLowerCase();
+    writer.textPadded(mnemonic, 4);
+
+    if (line.operand !== undefined) {
+      writer.text(' ');
+      this.emitCA65Operand(writer, line, operandSymbol);
+    }
+
+    if (this.options.includeComments && line.comment) {
+      writer.padTo(40);
+      writer.text(' ; ');
+      writer.text(line.comment);
+    }
+
+    if (this.options.includeTiming) {
+      const cycles = typeof line.instruction.cycles === 'number' ?
+        line.instruction.cycles : line.instruction.cycles.base;
+      writer.padTo(60);
+      writer.text(` ; ${cycles} cycles`);
+    }
+  }
+
+  /** Pooled-writer equivalent of formatOperand for the no-symbol path */
+  private emitCA65Operand(writer: PooledLineWriter, line: DisassemblyLine, operandSymbol?: string | null): void {
+    const operand = line.operand!;
+    const symbolName = operandSymbol !== undefined ? operandSymbol ?? undefined : this.getSymbolName(operand);
+    if (symbolName) {
+      writer.text(symbolName);
+      return;
+    }
+
+    const uppercase = this.options.uppercase !== false;
+    switch (line.instruction.addressingMode) {
+    case '#': // Immediate: leading digits of the 6-digit padded address
+      writer.text('#');
+      if (operand <= 0xFF) {
+        writer.hexByte((operand >>> 16) & 0xFF, uppercase);
+      } else {
+        writer.hexWord((operand >>> 8) & 0xFFFF, uppercase);
+      }
+      break;
+    case 'zp': // Zero Page / Direct Page: low byte only
+    case 'dp':
+      writer.hexByte(operand & 0xFF, uppercase);
+      break;
+    default: // abs/long/rel and everything else: full 24-bit address
+      writer.text('$');
+      writer.hexAddress(operand, uppercase);
+      break;
+    }
+  }
 }
 
 export class WLADXFormatter extends OutputFormatter {
+  private streamWriter: PooledLineWriter | null = null;
+
   getName(): string {
     return 'WLA-DX';
   }
@@ -284,6 +577,42 @@ export class WLADXFormatter extends OutputFormatter {
   }
 
   format(lines: DisassemblyLine[]): string {
+    const output = this.buildPreamble();
+
+    for (const line of lines) {
+      const formattedLine = this.formatWLALine(line);
+      if (formattedLine) {
+        output.push(formattedLine);
+      }
+    }
+
+    return output.join('\n');
+  }
+
+  formatToStream(lines: DisassemblyLine[], sink: (chunk: Buffer) => void): void {
+    this.beginStream(sink);
+    for (const line of lines) {
+      this.writeLine(line);
+    }
+    this.endStream();
+  }
+
+  beginStream(sink: (chunk: Buffer) => void): void {
+    this.streamWriter = new PooledLineWriter(sink);
+    this.streamWriter.text(this.buildPreamble().join('\n'));
+  }
+
+  writeLine(line: DisassemblyLine, operandSymbol?: string | null): void {
+    this.streamWriter!.text('\n');
+    this.emitWLALine(this.streamWriter!, line, operandSymbol);
+  }
+
+  endStream(): void {
+    this.streamWriter!.flush();
+    this.streamWriter = null;
+  }
+
+  private buildPreamble(): string[] {
     const output: string[] = [];
 
     // Add WLA-DX specific directives
@@ -317,14 +646,7 @@ export class WLADXFormatter extends OutputFormatter {
     output.push('.ORG $0000');
     output.push('');
 
-    for (const line of lines) {
-      const formattedLine = this.formatWLALine(line);
-      if (formattedLine) {
-        output.push(formattedLine);
-      }
-    }
-
-    return output.join('\n');
+    return output;
   }
 
   private addWLAMemoryMapping(output: string[]): void {
@@ -399,9 +721,72 @@ export class WLADXFormatter extends OutputFormatter {
       return `$${operand.toString(16).toUpperCase()}`;
     }
   }
+
+  /** Pooled-writer equivalent of formatWLALine */
+  private emitWLALine(writer: PooledLineWriter, line: DisassemblyLine, operandSymbol?: string | null): void {
+    writer.beginRecord();
+
+    if (line.label) {
+      writer.text(line.label);
+      writer.text(':\n');
+    }
+
+    const mnemonic = this.options.uppercase !== false ?
+      line.instruction.mnemonic.toUpperCase() :
+      line.instruction.mnemonic.toLowerCase();
+    writer.text('    ');
+    writer.text(mnemonic);
+
+    if (line.operand !== undefined) {
+      writer.text(' ');
+      this.emitWLAOperand(writer, line, operandSymbol);
+    }
+
+    if (this.options.includeComments && line.comment) {
+      writer.padTo(40);
+      writer.text(' ; ');
+      writer.text(line.comment);
+    }
+  }
+
+  /** Pooled-writer equivalent of formatWLAOperand for the no-symbol path */
+  private emitWLAOperand(writer: PooledLineWriter, line: DisassemblyLine, operandSymbol?: string | null): void {
+    const operand = line.operand!;
+    const symbolName = operandSymbol !== undefined ? operandSymbol ?? undefined : this.getSymbolName(operand);
+    if (symbolName) {
+      writer.text(symbolName);
+      return;
+    }
+
+    switch (line.instruction.addressingMode) {
+    case '#': // Immediate
+      writer.text('#$');
+      writer.hexMin(operand, 2);
+      break;
+    case 'abs': // Absolute
+      writer.text('$');
+      writer.hexMin(operand, 4);
+      break;
+    case 'long': // Absolute Long
+      writer.text('$');
+      writer.hexMin(operand, 6);
+      break;
+    case 'zp': // Zero Page
+    case 'dp': // Direct Page
+      writer.text('$');
+      writer.hexMin(operand, 2);
+      break;
+    default:
+      writer.text('$');
+      writer.hexMin(operand, 1);
+      break;
+    }
+  }
 }
 
 export class BassFormatter extends OutputFormatter {
+  private streamWriter: PooledLineWriter | null = null;
+
   getName(): string {
     return 'bass';
   }
@@ -411,6 +796,42 @@ export class BassFormatter extends OutputFormatter {
   }
 
   format(lines: DisassemblyLine[]): string {
+    const output = this.buildPreamble();
+
+    for (const line of lines) {
+      const formattedLine = this.formatBassLine(line);
+      if (formattedLine) {
+        output.push(formattedLine);
+      }
+    }
+
+    return output.join('\n');
+  }
+
+  formatToStream(lines: DisassemblyLine[], sink: (chunk: Buffer) => void): void {
+    this.beginStream(sink);
+    for (const line of lines) {
+      this.writeLine(line);
+    }
+    this.endStream();
+  }
+
+  beginStream(sink: (chunk: Buffer) => void): void {
+    this.streamWriter = new PooledLineWriter(sink);
+    this.streamWriter.text(this.buildPreamble().join('\n'));
+  }
+
+  writeLine(line: DisassemblyLine, operandSymbol?: string | null): void {
+    this.streamWriter!.text('\n');
+    this.emitBassLine(this.streamWriter!, line, operandSymbol);
+  }
+
+  endStream(): void {
+    this.streamWriter!.flush();
+    this.streamWriter = null;
+  }
+
+  private buildPreamble(): string[] {
     const output: string[] = [];
 
     // Add bass specific directives
@@ -440,15 +861,7 @@ export class BassFormatter extends OutputFormatter {
       output.push('');
     }
 
-    // Format disassembly lines
-    for (const line of lines) {
-      const formattedLine = this.formatBassLine(line);
-      if (formattedLine) {
-        output.push(formattedLine);
-      }
-    }
-
-    return output.join('\n');
+    return output;
   }
 
   private formatBassLine(line: DisassemblyLine): string {
@@ -504,6 +917,107 @@ export class BassFormatter extends OutputFormatter {
       return `$${operand.toString(16).toUpperCase()}`;
     }
   }
+
+  /** Pooled-writer equivalent of formatBassLine */
+  private emitBassLine(writer: PooledLineWriter, line: DisassemblyLine, operandSymbol?: string | null): void {
+    writer.beginRecord();
+
+    if (line.label) {
+      writer.text(line.label);
+      writer.text(':\n');
+    }
+
+    const mnemonic = this.options.uppercase !== false ?
+      line.instruction.mnemonic.toUpperCase() :
+      line.instruction.mnemonic.toLowerCase();
+    writer.text('  ');
+    writer.text(mnemonic);
+
+    if (line.operand !== undefined) {
+      writer.text(' ');
+      this.emitBassOperand(writer, line, operandSymbol);
+    }
+
+    if (this.options.includeComments && line.comment) {
+      writer.padTo(40);
+      writer.text(' // ');
+      writer.text(line.comment);
+    }
+  }
+
+  /** Pooled-writer equivalent of formatBassOperand for the no-symbol path */
+  private emitBassOperand(writer: PooledLineWriter, line: DisassemblyLine, operandSymbol?: string | null): void {
+    const operand = line.operand!;
+    const symbolName = operandSymbol !== undefined ? operandSymbol ?? undefined : this.getSymbolName(operand);
+    if (symbolName) {
+      writer.text(`{${symbolName}}`); // bass uses {} for symbols
+      return;
+    }
+
+    switch (line.instruction.addressingMode) {
+    case '#': // Immediate
+      writer.text('#$');
+      writer.hexMin(operand, 2);
+      break;
+    case 'abs': // Absolute
+      writer.text('$');
+      writer.hexMin(operand, 4);
+      break;
+    case 'long': // Absolute Long
+      writer.text('$');
+      writer.hexMin(operand, 6);
+      break;
+    default:
+      writer.text('$');
+      writer.hexMin(operand, 1);
+      break;
+    }
+  }
+}
+
+export interface ExportTarget {
+  formatter: OutputFormatter;
+  sink: (chunk: Buffer) => void;
+}
+
+/**
+ * Single-pass export into several output formats at once.
+ *
+ * Release builds export every ROM in CA65, WLA-DX and bass syntax; done
+ * naively that is one full formatter walk (and often one full disassemble)
+ * per format over identical lines. This exporter walks the lines once and
+ * feeds each formatter's incremental stream protocol per line, so decode
+ * and analysis run once and each formatter only pays for its own syntax.
+ *
+ * When the targets share one symbol table, pass it as sharedSymbols and
+ * the per-operand symbol lookup is also performed once per line instead
+ * of once per formatter. Each target's output is byte-identical to
+ * running formatToStream() on that formatter alone.
+ */
+export class MultiFormatExporter {
+  constructor(
+    private targets: ExportTarget[],
+    private sharedSymbols?: Map<number, SymbolTableEntry>
+  ) {}
+
+  export(lines: DisassemblyLine[]): void {
+    for (const target of this.targets) {
+      target.formatter.beginStream(target.sink);
+    }
+
+    for (const line of lines) {
+      const operandSymbol = this.sharedSymbols && line.operand !== undefined
+        ? this.sharedSymbols.get(line.operand)?.name ?? null
+        : undefined;
+      for (const target of this.targets) {
+        target.formatter.writeLine(line, operandSymbol);
+      }
+    }
+
+    for (const target of this.targets) {
+      target.formatter.endStream();
+    }
+  }
 }
 
 class OutputFormatterFactory {
@@ -0,0 +1,87 @@
+/**
+ * Worker entry point for parallel asset extraction.
+ *
+ * Spawned by AssetExtractor.extractAssetsParallel() with the ROM bytes in a
+ * SharedArrayBuffer and a list of extraction work items. Each item names an
+ * extractor kind and the ROM region it covers; the worker instantiates the
+ * matching extractor, runs its items sequentially, and posts all results
+ * back in one message keyed by item id so the main thread can aggregate in
+ * schedule order.
+ */
+
+import { parentPort, workerData } from 'worker_threads';
+import {
+  GraphicsExtractor,
+  TextExtractor,
+  AudioExtractor,
+  GraphicsFormat,
+  TextEncoding,
+  Tile,
+  TextString,
+  BRRSample
+} from './asset-extractor';
+
+export interface AssetWorkItem {
+  id: number;
+  kind: 'graphics-tiles' | 'text-strings' | 'audio-samples';
+  start: number;
+  end: number;
+  /** SNES address assigned to the first byte of the region */
+  baseAddress: number;
+  format?: GraphicsFormat;
+  encoding?: TextEncoding;
+  minLength?: number;
+}
+
+export interface AssetWorkerInput {
+  romBuffer: SharedArrayBuffer;
+  romLength: number;
+  items: AssetWorkItem[];
+}
+
+export interface AssetWorkResult {
+  id: number;
+  tiles?: Tile[];
+  strings?: TextString[];
+  samples?: BRRSample[];
+}
+
+async function runItems(input: AssetWorkerInput): Promise<AssetWorkResult[]> {
+  const rom = new Uint8Array(input.romBuffer, 0, input.romLength);
+  const graphicsExtractor = new GraphicsExtractor();
+  const textExtractor = new TextExtractor();
+  const audioExtractor = new AudioExtractor();
+  const results: AssetWorkResult[] = [];
+
+  for (const item of input.items) {
+    const region = rom.slice(item.start, item.end);
+
+    switch (item.kind) {
+    case 'graphics-tiles':
+      results.push({
+        id: item.id,
+        tiles: await graphicsExtractor.extractTiles(region, item.format || '4bpp', item.baseAddress)
+      });
+      break;
+    case 'text-strings':
+      results.push({
+        id: item.id,
+        strings: await textExtractor.extractStrings(region, item.encoding || 'ascii', item.baseAddress, item.minLength)
+      });
+      break;
+    case 'audio-samples':
+      results.push({
+        id: item.id,
+        samples: await audioExtractor.extractBRRSamples(region, item.baseAddress)
+      });
+      break;
+    }
+  }
+
+  return results;
+}
+
+if (parentPort) {
+  const port = parentPort;
+  void runItems(workerData as AssetWorkerInput).then(results => port.postMessage(results));
+}
@@ -0,0 +1,61 @@
+/**
+ * Worker entry point for parallel bank disassembly.
+ *
+ * Spawned by SNESDisassembler.disassembleParallel() with the ROM bytes in a
+ * SharedArrayBuffer and a list of bank-aligned address ranges to decode. Each
+ * range gets a fresh InstructionDecoder so processor flag state never leaks
+ * across bank boundaries, matching the assumption that banks are independent
+ * units of work. Decoded lines are posted back in one message per worker and
+ * merged in address order on the main thread.
+ */
+
+import { parentPort, workerData } from 'worker_threads';
+import { InstructionDecoder } from './decoder';
+import { BankHandler } from './bank-handler';
+import { DisassemblyLine } from './types';
+import { CartridgeInfo } from './cartridge-types';
+
+export interface ParallelWorkerInput {
+  romBuffer: SharedArrayBuffer;
+  romLength: number;
+  cartridgeInfo: CartridgeInfo;
+  ranges: Array<{ start: number; end: number }>;
+}
+
+function disassembleRanges(input: ParallelWorkerInput): DisassemblyLine[] {
+  const data = Buffer.from(input.romBuffer, 0, input.romLength);
+  const bankHandler = new BankHandler(input.cartridgeInfo);
+  const lines: DisassemblyLine[] = [];
+
+  for (const range of input.ranges) {
+    const decoder = new InstructionDecoder();
+    let address = range.start;
+
+    while (address < range.end) {
+      let romOffset: number;
+      try {
+        romOffset = bankHandler.addressToRomOffset(address);
+      } catch (error) {
+        break; // Range walked off the mappable ROM area
+      }
+
+      if (romOffset >= data.length) {
+        break;
+      }
+
+      const line = decoder.decode(data, romOffset, address);
+      if (!line) {
+        break;
+      }
+
+      lines.push(line);
+      address += line.instruction.bytes;
+    }
+  }
+
+  return lines;
+}
+
+if (parentPort) {
+  parentPort.postMessage(disassembleRanges(workerData as ParallelWorkerInput));
+}
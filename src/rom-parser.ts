@@ -53,7 +53,96 @@ export interface SNESRom {
   originalSize?: number;
 }
 
+/**
+ * Header-only view of a ROM produced by RomParser.parseHeaderOnly().
+ * Carries everything classification needs without the ROM body.
+ */
+export interface SNESRomSummary {
+  header: SNESHeader;
+  isHiRom: boolean;
+  hasHeader: boolean;
+  cartridgeInfo: CartridgeInfo;
+  memoryRegions: MemoryRegion[];
+  fileSize: number;
+  isSplitRom: boolean;
+}
+
+/**
+ * Windowed read access to a ROM file (or a set of split ROM parts) without
+ * loading the body into memory. Reads are positioned pread-style against the
+ * logical ROM stream: the 512-byte SMC copier header, when present, is
+ * transparently skipped, and split parts are treated as one contiguous image.
+ *
+ * Header-only triage pays for a stat plus two 64-byte window reads instead of
+ * a full multi-megabyte readFileSync; readAll() materializes the body only
+ * when a disassembly range actually needs it.
+ */
+export class RomFileReader {
+  private parts: Array<{ fd: number; start: number; size: number }> = [];
+  private totalSize = 0;
+  private smcOffset = 0;
+
+  constructor(filePaths: string[]) {
+    for (const filePath of filePaths) {
+      const size = fs.statSync(filePath).size;
+      this.parts.push({ fd: fs.openSync(filePath, 'r'), start: this.totalSize, size });
+      this.totalSize += size;
+    }
+
+    // SMC copier header detection mirrors RomParser.parse()
+    this.smcOffset = this.totalSize % 1024 === 512 ? 512 : 0;
+  }
+
+  /** Logical ROM size with any SMC header stripped */
+  get size(): number {
+    return this.totalSize - this.smcOffset;
+  }
+
+  /** Whether the underlying file carries a 512-byte SMC header */
+  get hasSmcHeader(): boolean {
+    return this.smcOffset !== 0;
+  }
+
+  /**
+   * Read a window of the logical ROM stream. Short reads at EOF return a
+   * correspondingly shorter Buffer.
+   */
+  read(romOffset: number, length: number): Buffer {
+    const start = romOffset + this.smcOffset;
+    const end = Math.min(start + length, this.totalSize);
+    const result = Buffer.alloc(Math.max(0, end - start));
+
+    let written = 0;
+    for (const part of this.parts) {
+      const partEnd = part.start + part.size;
+      if (partEnd <= start + written || part.start >= end) continue;
+
+      const readStart = start + written - part.start;
+      const readLength = Math.min(part.size - readStart, result.length - written);
+      fs.readSync(part.fd, result, written, readLength, readStart);
+      written += readLength;
+    }
+
+    return result;
+  }
+
+  /** Materialize the full ROM body (for actual disassembly passes) */
+  readAll(): Buffer {
+    return this.read(0, this.size);
+  }
+
+  close(): void {
+    for (const part of this.parts) {
+      fs.closeSync(part.fd);
+    }
+    this.parts = [];
+  }
+}
+
 export class RomParser {
+  /** Byte span scoreHeader()/parseHeader() probe beyond the header offset */
+  private static readonly HEADER_WINDOW_SIZE = 0x40;
+
   static parse(filePath: string): SNESRom {
     const data = fs.readFileSync(filePath);
 
@@ -83,8 +172,117 @@ export class RomParser {
     }
 
     const header = this.parseHeader(romData, headerOffset);
+    const { cartridgeInfo, memoryRegions } = this.buildCartridgeInfo(header);
+
+    return {
+      header,
+      data: romData,
+      isHiRom,
+      hasHeader,
+      cartridgeInfo,
+      memoryRegions
+    };
+  }
+
+  /**
+   * Classify a ROM by reading only the header-candidate windows.
+   *
+   * Reads two 64-byte windows (the LoROM and HiROM header locations that
+   * scoreHeader() probes) through RomFileReader instead of pulling the whole
+   * file - including combined split-ROM parts - into memory. Corpus-triage
+   * style callers that only need header metadata should use this; callers
+   * that go on to disassemble can promote the summary via parseLazy().
+   */
+  static parseHeaderOnly(filePath: string): SNESRomSummary {
+    const splitParts = this.detectSplitRom(filePath);
+    const reader = new RomFileReader(splitParts);
+
+    try {
+      const summary = this.parseHeaderFromReader(reader);
+      return { ...summary, isSplitRom: splitParts.length > 1 };
+    } finally {
+      reader.close();
+    }
+  }
+
+  /**
+   * Lazy parse: classify from header windows now, defer the body read.
+   *
+   * Returns the summary plus accessors backed by an open RomFileReader:
+   * readRange() serves windowed reads for partial disassembly, and getData()
+   * materializes (and memoizes) the full body only on first use. Callers own
+   * the reader lifetime via close().
+   */
+  static parseLazy(filePath: string): SNESRomSummary & {
+    readRange(romOffset: number, length: number): Buffer;
+    getData(): Buffer;
+    close(): void;
+  } {
+    const splitParts = this.detectSplitRom(filePath);
+    const reader = new RomFileReader(splitParts);
+    const summary = this.parseHeaderFromReader(reader);
+
+    let cachedData: Buffer | undefined;
+
+    return {
+      ...summary,
+      isSplitRom: splitParts.length > 1,
+      readRange: (romOffset: number, length: number) => reader.read(romOffset, length),
+      getData: () => {
+        if (!cachedData) {
+          cachedData = reader.readAll();
+        }
+        return cachedData;
+      },
+      close: () => reader.close()
+    };
+  }
+
+  /**
+   * Shared header classification against a windowed reader
+   */
+  private static parseHeaderFromReader(reader: RomFileReader): Omit<SNESRomSummary, 'isSplitRom'> {
+    const hiRomHeaderOffset = 0x7FC0;
+    const loRomHeaderOffset = 0xFFC0;
+
+    let headerOffset = loRomHeaderOffset;
+    let isHiRom = false;
+    let headerWindow = reader.read(loRomHeaderOffset, this.HEADER_WINDOW_SIZE);
+
+    if (reader.size > Math.max(loRomHeaderOffset, hiRomHeaderOffset) + this.HEADER_WINDOW_SIZE) {
+      const loRomWindow = headerWindow;
+      const hiRomWindow = reader.read(hiRomHeaderOffset, this.HEADER_WINDOW_SIZE);
+
+      const loRomScore = this.scoreHeader(loRomWindow, 0, false);
+      const hiRomScore = this.scoreHeader(hiRomWindow, 0, true);
+
+      if (hiRomScore > loRomScore) {
+        headerOffset = hiRomHeaderOffset;
+        isHiRom = true;
+        headerWindow = hiRomWindow;
+      }
+    } else {
+      // File too small for both candidates; fall back to whatever we can read
+      headerWindow = reader.read(Math.min(headerOffset, Math.max(0, reader.size - this.HEADER_WINDOW_SIZE)), this.HEADER_WINDOW_SIZE);
+    }
+
+    const header = this.parseHeader(headerWindow, 0);
+    const { cartridgeInfo, memoryRegions } = this.buildCartridgeInfo(header);
 
-    // Detect cartridge type and create enhanced cartridge info
+    return {
+      header,
+      isHiRom,
+      hasHeader: reader.hasSmcHeader,
+      cartridgeInfo,
+      memoryRegions,
+      fileSize: reader.size
+    };
+  }
+
+  /**
+   * Derive cartridge info and memory layout from a parsed header
+   */
+  private static buildCartridgeInfo(header: SNESHeader): { cartridgeInfo: CartridgeInfo; memoryRegions: MemoryRegion[] } {
     const cartridgeType = detectCartridgeType(header.mapMode, header.cartridgeType);
     const memorySpeed = getMemorySpeed(header.mapMode);
     const hasBattery = hasBatteryBackup(header.cartridgeType);
@@ -102,18 +300,10 @@ export class RomParser {
       specialChip: this.getSpecialChipName(cartridgeType)
     };
 
-    // Create memory layout
     const memoryRegions = createMemoryLayout(cartridgeInfo);
     cartridgeInfo.regions = memoryRegions;
 
-    return {
-      header,
-      data: romData,
-      isHiRom,
-      hasHeader,
-      cartridgeInfo,
-      memoryRegions
-    };
+    return { cartridgeInfo, memoryRegions };
   }
 
   private static scoreHeader(data: Buffer, offset: number, isHiRom: boolean): number {
@@ -413,9 +603,12 @@ export class RomParser {
     for (const offset of possibleOffsets) {
       if (offset + 0x20 >= data.length) continue;
 
-      // Check if header makes sense when de-interleaved
-      const deInterleavedData = this.deInterleaveRom(data);
-      const score = this.scoreHeader(deInterleavedData, offset, false);
+      // Check if the header makes sense when de-interleaved. Only the
+      // header window scoreHeader() probes needs swapping - the candidate
+      // offsets are even, so pair alignment is preserved - rather than
+      // de-interleaving the full image once per candidate.
+      const probe = this.deInterleavedWindow(data, offset, this.HEADER_WINDOW_SIZE);
+      const score = this.scoreHeader(probe, 0, false);
       const originalScore = this.scoreHeader(data, offset, false);
 
       if (score > originalScore + 2) { // Significant improvement
@@ -426,6 +619,16 @@ export class RomParser {
     return false;
   }
 
+  /** Byte-swapped copy of one probe window; `offset` must be even */
+  private static deInterleavedWindow(data: Buffer, offset: number, length: number): Buffer {
+    const window = Buffer.alloc(Math.min(length, data.length - offset));
+    for (let i = 0; i < window.length - 1; i += 2) {
+      window[i] = data[offset + i + 1];
+      window[i + 1] = data[offset + i];
+    }
+    return window;
+  }
+
   /**
    * De-interleave ROM data (swap odd/even bytes)
    */
@@ -440,6 +643,20 @@ export class RomParser {
     return deInterleaved;
   }
 
+  /**
+   * De-interleave by swapping each byte pair in place, avoiding the
+   * second full-size buffer deInterleaveRom() allocates. Safe whenever
+   * the caller owns the buffer (e.g. it was just read from disk).
+   */
+  static deInterleaveRomInPlace(data: Buffer): Buffer {
+    for (let i = 0; i < data.length - 1; i += 2) {
+      const even = data[i];
+      data[i] = data[i + 1];
+      data[i + 1] = even;
+    }
+    return data;
+  }
+
   /**
    * Detect overdumped ROMs (ROMs with extra data beyond the actual ROM size)
    * Common in older dumps where ROMs were padded to standard sizes
@@ -449,9 +666,28 @@ export class RomParser {
       return { isOverdumped: false, originalSize: data.length };
     }
 
-    // Check if extra data is just padding (zeros or repeated pattern)
-    const extraData = data.slice(expectedSize);
+    const extraLength = data.length - expectedSize;
+
+    // Large padding regions are judged from bounded probe windows rather
+    // than a byte-by-byte sweep; real content in the extra region almost
+    // always shows up in the first window or at a bank boundary
+    const isOverdumped = extraLength > RomParser.OVERDUMP_EXACT_SCAN_LIMIT
+      ? this.isPaddingSampled(data, expectedSize)
+      : this.isPaddingExact(data.slice(expectedSize));
 
+    return {
+      isOverdumped,
+      originalSize: isOverdumped ? expectedSize : data.length
+    };
+  }
+
+  /** Extra-region size up to which detectOverdump() scans every byte */
+  private static readonly OVERDUMP_EXACT_SCAN_LIMIT = 0x1000;
+  private static readonly OVERDUMP_WINDOW_SIZE = 0x100;
+  private static readonly OVERDUMP_MAX_WINDOWS = 32;
+
+  /** Full scan of the extra region; used when it is small */
+  private static isPaddingExact(extraData: Buffer): boolean {
     // Check for zero padding
     const isZeroPadded = extraData.every(byte => byte === 0x00);
 
@@ -472,12 +708,54 @@ export class RomParser {
       }
     }
 
-    const isOverdumped = isZeroPadded || isFFPadded || isRepeatedPattern;
+    return isZeroPadded || isFFPadded || isRepeatedPattern;
+  }
 
-    return {
-      isOverdumped,
-      originalSize: isOverdumped ? expectedSize : data.length
-    };
+  /**
+   * Decide whether [expectedSize, data.length) is padding from a bounded
+   * set of probe windows: the first and last window, every 32KB bank
+   * boundary in the extra region, and evenly spaced fill-ins, capped at
+   * OVERDUMP_MAX_WINDOWS. The candidate 4-byte pattern comes from the
+   * start of the extra region (covering zero fill, FF fill, and repeated
+   * patterns uniformly) and every window must match it at its own
+   * pattern phase.
+   */
+  private static isPaddingSampled(data: Buffer, expectedSize: number): boolean {
+    const extraLength = data.length - expectedSize;
+    const windowSize = RomParser.OVERDUMP_WINDOW_SIZE;
+
+    const windowStarts = new Set<number>();
+    windowStarts.add(expectedSize);
+    windowStarts.add(data.length - windowSize);
+
+    // Bank boundaries inside the extra region
+    const bankSize = 0x8000;
+    for (let addr = Math.ceil(expectedSize / bankSize) * bankSize;
+      addr + windowSize <= data.length && windowStarts.size < RomParser.OVERDUMP_MAX_WINDOWS;
+      addr += bankSize) {
+      windowStarts.add(addr);
+    }
+
+    // Evenly spaced fill-ins up to the window budget
+    const remaining = RomParser.OVERDUMP_MAX_WINDOWS - windowStarts.size;
+    for (let i = 1; i <= remaining; i++) {
+      const addr = expectedSize + Math.floor((extraLength * i) / (remaining + 1));
+      if (addr + windowSize <= data.length) {
+        windowStarts.add(addr);
+      }
+    }
+
+    const pattern = data.slice(expectedSize, expectedSize + 4);
+    for (const start of windowStarts) {
+      const end = Math.min(start + windowSize, data.length);
+      for (let i = Math.max(start, expectedSize); i < end; i++) {
+        if (data[i] !== pattern[(i - expectedSize) & 3]) {
+          return false;
+        }
+      }
+    }
+
+    return true;
   }
 
   /**
@@ -501,7 +779,9 @@ export class RomParser {
     // Check for interleaved format
     const isInterleaved = this.detectInterleavedFormat(data);
     if (isInterleaved) {
-      data = this.deInterleaveRom(data);
+      // The buffer was read (or concatenated) above, so it is ours to
+      // swap in place rather than copying into a second full-size buffer
+      data = this.deInterleaveRomInPlace(data);
     }
 
     // Parse basic ROM structure
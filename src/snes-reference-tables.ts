@@ -2893,6 +2893,73 @@ export const REGISTER_REFERENCE: Record<number, RegisterReference> = {
   }
 };
 
+// =====================================================================
+// FLAT LOOKUP INDEX
+// =====================================================================
+
+/**
+ * Flat indexes over the reference records above, built once on the first
+ * lookup. The instruction index is a dense 256-slot array addressed
+ * directly by opcode; register references sit behind a sorted Uint16Array
+ * of addresses searched with binary search. Validation runs per line and
+ * is enabled by default in the disassembler, so the hot lookup functions
+ * below go through these instead of walking the object literals.
+ */
+let instructionIndex: Array<InstructionReference | undefined> | null = null;
+let registerAddresses: Uint16Array | null = null;
+let registerIndex: RegisterReference[] = [];
+
+function buildInstructionIndex(): Array<InstructionReference | undefined> {
+  const index = new Array<InstructionReference | undefined>(256);
+  for (const key of Object.keys(INSTRUCTION_REFERENCE)) {
+    const opcode = Number(key);
+    index[opcode] = INSTRUCTION_REFERENCE[opcode];
+  }
+  return index;
+}
+
+function buildRegisterIndex(): Uint16Array {
+  const addresses = Object.keys(REGISTER_REFERENCE)
+    .map(Number)
+    .sort((a, b) => a - b);
+  registerIndex = addresses.map(address => REGISTER_REFERENCE[address]);
+  return Uint16Array.from(addresses);
+}
+
+/**
+ * Look up an instruction reference by opcode via the flat index
+ */
+export function lookupInstruction(opcode: number): InstructionReference | undefined {
+  if (!instructionIndex) {
+    instructionIndex = buildInstructionIndex();
+  }
+  return opcode >= 0x00 && opcode <= 0xFF ? instructionIndex[opcode] : undefined;
+}
+
+/**
+ * Look up a register reference by address via binary search
+ */
+export function lookupRegister(address: number): RegisterReference | undefined {
+  if (!registerAddresses) {
+    registerAddresses = buildRegisterIndex();
+  }
+  let low = 0;
+  let high = registerAddresses.length - 1;
+  while (low <= high) {
+    const mid = (low + high) >>> 1;
+    const candidate = registerAddresses[mid];
+    if (candidate === address) {
+      return registerIndex[mid];
+    }
+    if (candidate < address) {
+      low = mid + 1;
+    } else {
+      high = mid - 1;
+    }
+  }
+  return undefined;
+}
+
 // =====================================================================
 // UTILITY FUNCTIONS FOR VALIDATION
 // =====================================================================
@@ -2905,7 +2972,7 @@ export function validateInstruction(opcode: number, expectedMnemonic?: string, e
   reference?: InstructionReference;
   discrepancies: string[];
 } {
-  const reference = INSTRUCTION_REFERENCE[opcode];
+  const reference = lookupInstruction(opcode);
   const discrepancies: string[] = [];
 
   if (!reference) {
@@ -2938,7 +3005,7 @@ export function validateRegister(address: number, operation: 'read' | 'write'):
   reference?: RegisterReference;
   warnings: string[];
 } {
-  const reference = REGISTER_REFERENCE[address];
+  const reference = lookupRegister(address);
   const warnings: string[] = [];
 
   if (!reference) {
@@ -2971,7 +3038,7 @@ export function getRegisterInfo(address: number): {
   category?: string;
   bitDescription?: string;
 } {
-  const reference = REGISTER_REFERENCE[address];
+  const reference = lookupRegister(address);
   if (!reference) {
     return {};
   }
@@ -2992,7 +3059,7 @@ export function getRegisterInfo(address: number): {
  * Generate enhanced instruction comment with reference data
  */
 export function generateInstructionComment(opcode: number, _operand?: number): string {
-  const reference = INSTRUCTION_REFERENCE[opcode];
+  const reference = lookupInstruction(opcode);
   if (!reference) {
     return '';
   }
@@ -3014,7 +3081,7 @@ export function generateInstructionComment(opcode: number, _operand?: number): s
  * Generate enhanced register comment with reference data
  */
 export function generateRegisterComment(address: number, operation: 'read' | 'write'): string {
-  const reference = REGISTER_REFERENCE[address];
+  const reference = lookupRegister(address);
   if (!reference) {
     return '';
   }
@@ -105,9 +105,9 @@ export interface SPCExportOptions {
 export class SPCExporter {
   private static readonly SPC_HEADER = 'SNES-SPC700 Sound File Data'; // Exactly 27 bytes
   private static readonly SPC_SIGNATURE = [0x1A, 26, 26]; // Version markers: 0x1A followed by two 26 values
-  private static readonly RAM_SIZE = 0x10000;     // 64KB
-  private static readonly DSP_REG_SIZE = 0x80;    // 128 bytes
-  private static readonly EXTRA_RAM_SIZE = 0x40;  // 64 bytes
+  protected static readonly RAM_SIZE = 0x10000;     // 64KB
+  protected static readonly DSP_REG_SIZE = 0x80;    // 128 bytes
+  protected static readonly EXTRA_RAM_SIZE = 0x40;  // 64 bytes
 
   /**
    * Export SPC700 and DSP state to SPC file format
@@ -190,7 +190,7 @@ export class SPCExporter {
   /**
    * Write SPC file header including SPC700 register states
    */
-  private static writeHeader(
+  protected static writeHeader(
     buffer: Uint8Array,
     offset: number,
     spcState: SPC700State,
@@ -239,7 +239,7 @@ export class SPCExporter {
   /**
    * Write ID666 metadata tags
    */
-  private static writeID666(
+  protected static writeID666(
     buffer: Uint8Array,
     offset: number,
     metadata: ID666Metadata,
@@ -437,7 +437,7 @@ export class SPCExporter {
   /**
    * Validate exported SPC file
    */
-  private static validateSPCFile(buffer: Uint8Array): void {
+  protected static validateSPCFile(buffer: Uint8Array): void {
     // Check minimum file size
     if (buffer.length < 0x10200) {
       throw new Error('SPC file too small');
@@ -532,4 +532,121 @@ export class SPCExporter {
   }
 }
 
+/**
+ * One snapshot in a batch export: the per-song deltas against the shared
+ * base state. Register fields default to the base SPC700 state; ramPatches
+ * overlay driver state (current song index, sequence pointers) onto the
+ * shared RAM image and are reverted before the next snapshot is emitted.
+ */
+export interface SPCSnapshot {
+  songTitle?: string;
+  pc?: number;
+  a?: number;
+  x?: number;
+  y?: number;
+  psw?: number;
+  sp?: number;
+  metadata?: Partial<ID666Metadata>;
+  ramPatches?: Array<{ address: number; data: Uint8Array }>;
+}
+
+/**
+ * Batch SPC export sharing one extracted audio state.
+ *
+ * Soundtrack exports emit 20-40 SPCs per game that differ only in entry
+ * point, a few driver bytes of RAM, and metadata. exportSPC() rebuilds
+ * and copies the full ~66KB file for each one; here the invariant tail -
+ * the 64KB RAM image, DSP registers, and the unused/extra regions - is
+ * rendered once into a pooled buffer, and each snapshot only rewrites the
+ * 256-byte header block and applies (then reverts) its RAM patches.
+ *
+ * The Uint8Array returned by exportSnapshot() is a view into the pooled
+ * buffer and is only valid until the next snapshot is emitted; write it
+ * out or copy it first. exportToFile() handles the common case.
+ */
+export class SPCBatchExporter extends SPCExporter {
+  private buffer: Uint8Array;
+  private ramOffset: number;
+  private pendingReverts: Array<{ offset: number; saved: Uint8Array }> = [];
+  private validated = false;
+
+  constructor(
+    private baseSpcState: SPC700State,
+    private baseDspState: DSPState,
+    private baseMetadata: ID666Metadata = {},
+    private options: SPCExportOptions = {}
+  ) {
+    super();
+
+    const headerSize = 0x100;
+    const unusedSize = 0x40;
+    this.buffer = new Uint8Array(
+      headerSize + SPCExporter.RAM_SIZE + SPCExporter.DSP_REG_SIZE + unusedSize + SPCExporter.EXTRA_RAM_SIZE
+    );
+
+    // Render the invariant tail once: RAM, DSP registers, unused, extra RAM
+    this.ramOffset = headerSize;
+    this.buffer.set(baseSpcState.ram, this.ramOffset);
+    this.buffer.set(baseDspState.registers, this.ramOffset + SPCExporter.RAM_SIZE);
+    // Unused and extra RAM regions stay zero from allocation
+  }
+
+  /**
+   * Emit one snapshot into the pooled buffer and return a view of it.
+   * Only the header block and the snapshot's RAM patches are written.
+   */
+  exportSnapshot(snapshot: SPCSnapshot): Uint8Array {
+    const { includeID666 = true, binaryFormat = false, validate = true } = this.options;
+
+    // Revert the previous snapshot's RAM patches before applying new ones
+    for (const revert of this.pendingReverts) {
+      this.buffer.set(revert.saved, revert.offset);
+    }
+    this.pendingReverts = [];
+
+    if (snapshot.ramPatches) {
+      for (const patch of snapshot.ramPatches) {
+        const offset = this.ramOffset + (patch.address & 0xFFFF);
+        this.pendingReverts.push({ offset, saved: this.buffer.slice(offset, offset + patch.data.length) });
+        this.buffer.set(patch.data, offset);
+      }
+    }
+
+    // Rebuild the 256-byte header block for this snapshot's registers
+    this.buffer.fill(0, 0, 0x100);
+    const snapshotState: SPC700State = {
+      ...this.baseSpcState,
+      pc: snapshot.pc ?? this.baseSpcState.pc,
+      a: snapshot.a ?? this.baseSpcState.a,
+      x: snapshot.x ?? this.baseSpcState.x,
+      y: snapshot.y ?? this.baseSpcState.y,
+      psw: snapshot.psw ?? this.baseSpcState.psw,
+      sp: snapshot.sp ?? this.baseSpcState.sp
+    };
+    const offset = SPCExporter.writeHeader(this.buffer, 0, snapshotState, includeID666, binaryFormat);
+
+    if (includeID666) {
+      SPCExporter.writeID666(this.buffer, offset, {
+        ...this.baseMetadata,
+        ...snapshot.metadata,
+        songTitle: snapshot.songTitle ?? snapshot.metadata?.songTitle ?? this.baseMetadata.songTitle
+      }, binaryFormat);
+    }
+
+    // The tail never changes, so one validation covers the whole batch
+    if (validate && !this.validated) {
+      SPCExporter.validateSPCFile(this.buffer);
+      this.validated = true;
+    }
+
+    return this.buffer;
+  }
+
+  /** Emit one snapshot and write it straight to disk */
+  exportToFile(filePath: string, snapshot: SPCSnapshot): void {
+    const fs = require('fs');
+    fs.writeFileSync(filePath, this.exportSnapshot(snapshot));
+  }
+}
+
 // Export types for use in other modules
@@ -33,11 +33,30 @@ export interface BulkOperationResult {
   errors: string[];
 }
 
+export interface NearestSymbolMatch {
+  address: number;
+  symbol: SymbolTableEntry;
+  /** Distance from the queried address to the symbol (0 for exact hits) */
+  offset: number;
+}
+
 export class SymbolManager {
   private symbols: Map<number, SymbolTableEntry>;
   private nameToAddress: Map<string, number>;
   private readonly reservedNames: Set<string>;
 
+  /**
+   * Sorted address index for nearest-symbol and range queries.
+   *
+   * Operand symbolization is a per-line cost in the formatters, and a plain
+   * Map cannot answer "nearest label at or below this address" without a
+   * full scan. The index is a sorted Uint32Array of symbol addresses with a
+   * parallel entry array, rebuilt lazily on the first query after any
+   * mutation, so bulk imports pay for one sort instead of one per insert.
+   */
+  private sortedAddresses: Uint32Array | null = null;
+  private sortedEntries: SymbolTableEntry[] = [];
+
   constructor() {
     this.symbols = new Map();
     this.nameToAddress = new Map();
@@ -86,6 +105,7 @@ export class SymbolManager {
     if (validation.isValid) {
       this.symbols.set(address, entry);
       this.nameToAddress.set(entry.name, address);
+      this.sortedAddresses = null;
     }
 
     return validation;
@@ -99,6 +119,7 @@ export class SymbolManager {
     if (symbol) {
       this.symbols.delete(address);
       this.nameToAddress.delete(symbol.name);
+      this.sortedAddresses = null;
       return true;
     }
     return false;
@@ -125,6 +146,134 @@ export class SymbolManager {
     return new Map(this.symbols);
   }
 
+  /**
+   * Find the symbol at the given address, or the nearest one below it.
+   *
+   * This is what `label+offset` operand rendering needs: an exact hit
+   * returns offset 0, otherwise the closest preceding symbol with the
+   * distance to it. `maxOffset` bounds how far back the match may lie so
+   * unrelated labels are not dragged across bank boundaries.
+   */
+  findNearestSymbol(address: number, maxOffset: number = 0xFFFF): NearestSymbolMatch | undefined {
+    this.ensureIndex();
+    const index = this.floorIndex(address);
+    if (index < 0) {
+      return undefined;
+    }
+
+    const symbolAddress = this.sortedAddresses![index];
+    const offset = address - symbolAddress;
+    if (offset > maxOffset) {
+      return undefined;
+    }
+
+    return {
+      address: symbolAddress,
+      symbol: this.sortedEntries[index],
+      offset
+    };
+  }
+
+  /**
+   * Get all symbols in the address range [start, end], sorted by address
+   */
+  getSymbolsInRange(start: number, end: number): NearestSymbolMatch[] {
+    this.ensureIndex();
+    const addresses = this.sortedAddresses!;
+    const results: NearestSymbolMatch[] = [];
+
+    // First index at or above start, then walk forward until past end
+    let index = this.floorIndex(start);
+    if (index < 0 || addresses[index] < start) {
+      index++;
+    }
+
+    for (; index < addresses.length && addresses[index] <= end; index++) {
+      results.push({
+        address: addresses[index],
+        symbol: this.sortedEntries[index],
+        offset: 0
+      });
+    }
+
+    return results;
+  }
+
+  /**
+   * Ingest a large batch of symbols without per-entry overhead.
+   *
+   * Intended for .sym/.mlb files produced by other tools, which arrive in
+   * the thousands and are trusted as-is: no name validation, no conflict
+   * reporting, later entries win. Existing symbols at the same address or
+   * name are replaced. Returns the number of symbols ingested.
+   */
+  bulkLoadSymbols(symbols: Iterable<[number, SymbolTableEntry]>): number {
+    let loaded = 0;
+    for (const [address, entry] of symbols) {
+      const existing = this.symbols.get(address);
+      if (existing && existing.name !== entry.name) {
+        this.nameToAddress.delete(existing.name);
+      }
+      const existingAddress = this.nameToAddress.get(entry.name);
+      if (existingAddress !== undefined && existingAddress !== address) {
+        this.symbols.delete(existingAddress);
+      }
+      this.symbols.set(address, entry);
+      this.nameToAddress.set(entry.name, address);
+      loaded++;
+    }
+    if (loaded > 0) {
+      this.sortedAddresses = null;
+    }
+    return loaded;
+  }
+
+  /**
+   * Rebuild the sorted address index if a mutation invalidated it
+   */
+  private ensureIndex(): void {
+    if (this.sortedAddresses) {
+      return;
+    }
+
+    const addresses = new Uint32Array(this.symbols.size);
+    let count = 0;
+    for (const address of this.symbols.keys()) {
+      addresses[count++] = address;
+    }
+    addresses.sort();
+
+    const entries = new Array<SymbolTableEntry>(count);
+    for (let i = 0; i < count; i++) {
+      entries[i] = this.symbols.get(addresses[i])!;
+    }
+
+    this.sortedAddresses = addresses;
+    this.sortedEntries = entries;
+  }
+
+  /**
+   * Binary search: index of the last address <= target, or -1 if none
+   */
+  private floorIndex(target: number): number {
+    const addresses = this.sortedAddresses!;
+    let lo = 0;
+    let hi = addresses.length - 1;
+    let result = -1;
+
+    while (lo <= hi) {
+      const mid = (lo + hi) >>> 1;
+      if (addresses[mid] <= target) {
+        result = mid;
+        lo = mid + 1;
+      } else {
+        hi = mid - 1;
+      }
+    }
+
+    return result;
+  }
+
   /**
    * Validate a symbol entry
    */
@@ -261,6 +410,7 @@ export class SymbolManager {
         if (!hasConflict) {
           this.symbols.set(address, entry);
           this.nameToAddress.set(entry.name, address);
+          this.sortedAddresses = null;
           result.succeeded++;
         } else {
           result.failed++;
@@ -600,6 +750,8 @@ export class SymbolManager {
   clear(): void {
     this.symbols.clear();
     this.nameToAddress.clear();
+    this.sortedAddresses = null;
+    this.sortedEntries = [];
   }
 
   /**
@@ -0,0 +1,186 @@
+/**
+ * Hot-Path Instrumentation for SNES Disassembler
+ *
+ * Low-overhead counters and histogram timers for per-line hot paths.
+ *
+ * This module deliberately depends on nothing but perf_hooks: the decoder
+ * and analysis engine import it, and pulling the pino-backed logger into
+ * their compile graph would break consumers (including the jest suite)
+ * that run without the logging dependencies installed.
+ *
+ * measurePerformance() in utils/logger allocates a tracking context and
+ * logs on every call, which would dominate any loop that runs per
+ * instruction. Here, counter and timer names are interned once at module
+ * load; afterwards the hot path is a typed-array increment (counters) or
+ * a performance.now() pair recorded into a power-of-two microsecond
+ * histogram bucket (timers). Timers additionally support 1-in-N sampling
+ * so even per-instruction call sites stay cheap.
+ *
+ * Everything is off unless SNES_DISASM_INSTRUMENT=1 is set or enable()
+ * is called; when off, each call is a single boolean check. report()
+ * returns a one-shot snapshot and logReport() dumps it through the main
+ * logger (loaded lazily, only when a report is actually requested).
+ */
+
+import { performance } from 'perf_hooks';
+
+export class HotPathInstrumentation {
+  private enabled = process.env.SNES_DISASM_INSTRUMENT === '1';
+
+  private counterNames: string[] = [];
+  private counts = new Float64Array(0);
+
+  private timerNames: string[] = [];
+  private timerBuckets: Uint32Array[] = [];
+  private timerCounts = new Float64Array(0);
+  private timerSums = new Float64Array(0);
+  private timerMax = new Float64Array(0);
+  private timerTicks: number[] = [];
+  private sampleInterval = 1;
+
+  enable(): void {
+    this.enabled = true;
+  }
+
+  disable(): void {
+    this.enabled = false;
+  }
+
+  isEnabled(): boolean {
+    return this.enabled;
+  }
+
+  /** Record only 1 in every n timer samples (counters are never sampled) */
+  setSampleInterval(n: number): void {
+    this.sampleInterval = Math.max(1, Math.floor(n));
+  }
+
+  /** Intern a counter name, returning the id used by increment() */
+  counter(name: string): number {
+    const existing = this.counterNames.indexOf(name);
+    if (existing >= 0) return existing;
+    this.counterNames.push(name);
+    const grown = new Float64Array(this.counterNames.length);
+    grown.set(this.counts);
+    this.counts = grown;
+    return this.counterNames.length - 1;
+  }
+
+  /** Hot path: a guarded typed-array increment */
+  increment(id: number, by: number = 1): void {
+    if (!this.enabled) return;
+    this.counts[id] += by;
+  }
+
+  /** Intern a timer name, returning the id used by timeStart()/timeEnd() */
+  timer(name: string): number {
+    const existing = this.timerNames.indexOf(name);
+    if (existing >= 0) return existing;
+    this.timerNames.push(name);
+    this.timerBuckets.push(new Uint32Array(32));
+    this.timerTicks.push(0);
+    const count = this.timerNames.length;
+    const grow = (old: Float64Array): Float64Array => {
+      const next = new Float64Array(count);
+      next.set(old);
+      return next;
+    };
+    this.timerCounts = grow(this.timerCounts);
+    this.timerSums = grow(this.timerSums);
+    this.timerMax = grow(this.timerMax);
+    return count - 1;
+  }
+
+  /**
+   * Start a timer sample. Returns 0 when disabled or sampled out; pass
+   * the result straight to timeEnd(), which ignores the 0 sentinel.
+   */
+  timeStart(id: number): number {
+    if (!this.enabled) return 0;
+    if (this.sampleInterval > 1 && ++this.timerTicks[id] % this.sampleInterval !== 0) return 0;
+    return performance.now();
+  }
+
+  timeEnd(id: number, start: number): void {
+    if (start === 0) return;
+    const durationMs = performance.now() - start;
+    const micros = Math.round(durationMs * 1000);
+    // 32 - clz32 is the bit length: bucket k holds durations in [2^(k-1), 2^k) us
+    const bucket = Math.min(31, 32 - Math.clz32(micros < 1 ? 1 : micros));
+    this.timerBuckets[id][bucket]++;
+    this.timerCounts[id]++;
+    this.timerSums[id] += durationMs;
+    if (durationMs > this.timerMax[id]) {
+      this.timerMax[id] = durationMs;
+    }
+  }
+
+  /** One-shot snapshot of every counter and timer */
+  report(): {
+    counters: Record<string, number>;
+    timers: Record<string, { samples: number; totalMs: number; meanMs: number; maxMs: number; p50Us: number; p90Us: number }>;
+    } {
+    const counters: Record<string, number> = {};
+    this.counterNames.forEach((name, id) => {
+      counters[name] = this.counts[id];
+    });
+
+    const timers: Record<string, { samples: number; totalMs: number; meanMs: number; maxMs: number; p50Us: number; p90Us: number }> = {};
+    this.timerNames.forEach((name, id) => {
+      const samples = this.timerCounts[id];
+      timers[name] = {
+        samples,
+        totalMs: Math.round(this.timerSums[id] * 100) / 100,
+        meanMs: samples > 0 ? Math.round((this.timerSums[id] / samples) * 10000) / 10000 : 0,
+        maxMs: Math.round(this.timerMax[id] * 100) / 100,
+        p50Us: this.percentileUpperBoundUs(id, 0.5),
+        p90Us: this.percentileUpperBoundUs(id, 0.9)
+      };
+    });
+
+    return { counters, timers };
+  }
+
+  /** Upper bound of the histogram bucket containing the given percentile */
+  private percentileUpperBoundUs(id: number, fraction: number): number {
+    const total = this.timerCounts[id];
+    if (total === 0) return 0;
+    const target = total * fraction;
+    const buckets = this.timerBuckets[id];
+    let seen = 0;
+    for (let bucket = 0; bucket < 32; bucket++) {
+      seen += buckets[bucket];
+      if (seen >= target) {
+        return 2 ** bucket;
+      }
+    }
+    return 2 ** 31;
+  }
+
+  /** Zero all counters and histograms, keeping interned names and ids */
+  reset(): void {
+    this.counts.fill(0);
+    this.timerCounts.fill(0);
+    this.timerSums.fill(0);
+    this.timerMax.fill(0);
+    this.timerTicks.fill(0);
+    for (const buckets of this.timerBuckets) {
+      buckets.fill(0);
+    }
+  }
+
+  /** Dump the report through the main application logger */
+  logReport(): void {
+    // Required lazily so the logger (and its pino dependency) stays out
+    // of this module's compile graph; hot-path importers never hit this.
+    // eslint-disable-next-line @typescript-eslint/no-var-requires
+    const { createLogger } = require('./logger');
+    createLogger('Instrumentation').info('Hot-path instrumentation report', this.report());
+  }
+}
+
+/**
+ * Process-wide instrumentation instance; call sites intern their ids at
+ * module load and hit only increment/timeStart/timeEnd afterwards
+ */
+export const instrumentation = new HotPathInstrumentation();
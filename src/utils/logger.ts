@@ -266,6 +266,11 @@ export function logApplicationShutdown(exitCode: number = 0): void {
   mainLogger.info('🛑 SNES Disassembler shutting down', { exitCode });
 }
 
+// Hot-path instrumentation lives in ./instrumentation so per-line hot
+// paths (decoder, analysis engine) can import it without pulling pino
+// into their compile graph; re-exported here for convenience
+export { HotPathInstrumentation, instrumentation } from './instrumentation';
+
 // Performance measurement decorator
 export function measurePerformance(logger: Logger, operation: string) {
   return function (target: any, propertyName: string, descriptor: PropertyDescriptor) {
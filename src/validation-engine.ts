@@ -8,6 +8,8 @@
 import {
   INSTRUCTION_REFERENCE,
   REGISTER_REFERENCE,
+  lookupInstruction,
+  lookupRegister,
   validateInstruction,
   validateRegister,
   getRegisterInfo,
@@ -693,28 +695,28 @@ export class SNESValidationEngine {
  * Quick validation of an instruction opcode
  */
 export function quickValidateOpcode(opcode: number): boolean {
-  return opcode in INSTRUCTION_REFERENCE;
+  return lookupInstruction(opcode) !== undefined;
 }
 
 /**
  * Quick validation of a register address
  */
 export function quickValidateRegister(address: number): boolean {
-  return address in REGISTER_REFERENCE;
+  return lookupRegister(address) !== undefined;
 }
 
 /**
  * Get reference data for an instruction
  */
 export function getInstructionReference(opcode: number): InstructionReference | undefined {
-  return INSTRUCTION_REFERENCE[opcode];
+  return lookupInstruction(opcode);
 }
 
 /**
  * Get reference data for a register
  */
 export function getRegisterReference(address: number): RegisterReference | undefined {
-  return REGISTER_REFERENCE[address];
+  return lookupRegister(address);
 }
 
 /**
@@ -9,7 +9,7 @@
  */
 
 import { InstructionDecoder } from '../src/decoder';
-import { INSTRUCTION_SET } from '../src/instructions';
+import { INSTRUCTION_SET, OPCODE_TABLE, OPCODE_BYTES, OPCODE_BASE_CYCLES } from '../src/instructions';
 import { INSTRUCTION_REFERENCE } from '../src/snes-reference-tables';
 import { AddressingMode, ProcessorFlags } from '../src/types';
 
@@ -76,6 +76,33 @@ describe('65816 Instruction Coverage Tests', () => {
     });
   });
 
+  describe('Opcode Dispatch Tables', () => {
+    test('OPCODE_TABLE mirrors INSTRUCTION_SET exactly', () => {
+      expect(OPCODE_TABLE.length).toBe(256);
+
+      for (let opcode = 0; opcode < 256; opcode++) {
+        const mapped = INSTRUCTION_SET.get(opcode);
+        const indexed = OPCODE_TABLE[opcode];
+
+        if (mapped) {
+          expect(indexed).toEqual(mapped);
+          expect(Object.isFrozen(indexed)).toBe(true);
+        } else {
+          expect(indexed).toBeUndefined();
+        }
+      }
+    });
+
+    test('OPCODE_BYTES and OPCODE_BASE_CYCLES agree with instruction records', () => {
+      for (const [opcode, instruction] of INSTRUCTION_SET) {
+        expect(OPCODE_BYTES[opcode]).toBe(instruction.bytes);
+
+        const baseCycles = typeof instruction.cycles === 'number' ? instruction.cycles : instruction.cycles.base;
+        expect(OPCODE_BASE_CYCLES[opcode]).toBe(baseCycles);
+      }
+    });
+  });
+
   describe('Critical Instruction Accuracy', () => {
     test('BRK instruction should be properly decoded', () => {
       const data = Buffer.from([0x00, 0x00]); // BRK with signature byte